@@ -9,16 +9,16 @@
 #include "stm32f4xx.h"
 #include "utils/utils.h"
 #include "dot/dot.h"
+#include "runden/runden.h"
+#include "joystick/joystick.h"
 #include <stdio.h>
 
-/* denken Sie daran in die Datei : stm32f4xx_it.c von Stopwatch sowie in die dot.c die callbackfunktion:
- * EXTI0_IRQHandler bzw void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) und die HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
- * sowie TIM1_UP_TIM10_IRQHandler(void) in die stm32f4xx_it.c von Stopwatch   Auszukommentieren
- * aber dann die in Fan kommentieren denn beide werden auch in die P1_Fan.c implemetiert bzw aufgerunfen
- * und das Problem ist, dass es zu fehler multiple definition of.... wenn man das mehrmals implemetiert
+/* Die Stoppuhr braucht weder EXTI0_IRQHandler / HAL_GPIO_EXTI_Callback noch TIM1_UP_TIM10_IRQHandler:
+ * die Zeitbasis TIM5 läuft frei, die USER-TASTE wird über Input Capture auf TIM5_CH1 erfasst und
+ * TIM5_IRQHandler in der stm32f4xx_it.c ruft stopwatch_capture_irq() auf. Es wird kein HAL-Callback
+ * benutzt, daher gibt es keine multiple definition mit den Callbacks in P1_Fan.c oder env_sensor.c
  *
- * Also einfach auf Callbackfunktion von funktion in der Source datei selbst und in der stm32f4xx_it.c der jeweilligen datei achten
-
+ * Joystick hoch/runter blättert in der Rundenliste
  */
 int main(void)
 {
@@ -27,6 +27,10 @@ int main(void)
 	    lcd_init();
 	    stopwatch_gpio_init();
 	    stopwatch_timer_init();
+	    runden_init();
+	    joystick_init();
+
+	    uint16_t joystick_vorher = 0;
 
 
 	    lcd_draw_text_at_coord("Chrono Ready", 10, 10, BLACK, 2, WHITE);
@@ -40,6 +44,18 @@ int main(void)
 	    	taste_verarbeitung();
 	    	gesamtdauer_anzeigen();
 
+	    	// Joystick ist low-aktiv, nur die Flanke blättert eine Seite weiter
+	    	uint16_t joystick = ~utils_gpio_port_read(JOY_GPIO_PORT) & (JOY_PIN_UP | JOY_PIN_DOWN);
+	    	uint16_t gedrueckt = joystick & ~joystick_vorher;
+	    	joystick_vorher = joystick;
+
+	    	if (gedrueckt & JOY_PIN_UP) {
+	    		stopwatch_seite_blaettern(-1);
+	    	}
+	    	if (gedrueckt & JOY_PIN_DOWN) {
+	    		stopwatch_seite_blaettern(1);
+	    	}
+
 	    }
 }
 
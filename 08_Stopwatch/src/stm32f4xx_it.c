@@ -49,6 +49,13 @@ void  TIM1_UP_TIM10_IRQHandler(void){
 }*/
 
 
+// Input Capture der USER-TASTE auf TIM5_CH1 und Anzeigetakt auf TIM5_CH2 (Zeitbasis der Stoppuhr)
+void TIM5_IRQHandler(void)
+{
+	stopwatch_capture_irq();
+	stopwatch_anzeige_irq();
+}
+
 // Handler de l'interruption externe sur PG12 (Press_bouton) Auskommentieren wenn Stopwatch beutzt werden soll
 /*void EXTI0_IRQHandler(void)
 {
@@ -35,6 +35,23 @@ int main (void){
 	 char soll_Wert[64];
 	 char buffer[32];
 
+	 uint32_t MAX_RPM = 4000;
+
+	 // Balken merken sich ihre Füllbreite, pro Update wird nur die Änderung gezeichnet
+	 my_lcd_bargraph_t soll_balken;
+	 my_lcd_bargraph_init(&soll_balken, 10, 70, 200, 20, RED, BLACK);
+
+	 // Drehzahlmesser für den Ist Wert zwischen Ist Text und ADC Zeile, 0..4000 rpm über 270 Grad,
+	 // ein Strich alle 500 rpm. Die Skala wird nur hier gezeichnet, pro Update nur die Nadel
+	 my_lcd_dial_t ist_zeiger;
+	 my_lcd_dial_init(&ist_zeiger, 120, 138, 31, -135, 270, 0, MAX_RPM, 8, BLACK, BLUE, WHITE);
+
+	 // Verlauf von Soll (rot) und Ist (blau) im unteren Bildschirmteil, eine Zeile pro Reglertakt,
+	 // das Display rollt selbst weiter
+	 const uint16_t verlauf_farben[2] = {RED, BLUE};
+	 my_lcd_rollchart_t verlauf;
+	 my_lcd_rollchart_init(&verlauf, 195, 125, BLACK, verlauf_farben, 2);
+
 	 while (1) {
 	    if (pi_update_flag) {
 	        pi_update_flag = 0;
@@ -50,13 +67,15 @@ int main (void){
 	        lcd_draw_text_at_line(ist_Wert, 5, BLACK, 2, WHITE);
 
 	        // Konvertieren von Soll und Ist Werte in promill
-	        uint32_t MAX_RPM = 4000;
 	        uint16_t soll_promille = (soll > MAX_RPM) ? 1000 : (soll * 1000) / MAX_RPM;
 	        uint16_t ist_promille  = (ist  > MAX_RPM) ? 1000 : (ist  * 1000) / MAX_RPM;
 
-	        // Darstellen von Soll und Ist Werte als Bargraph
-	        my_lcd_draw_baargraph(10, 70, 200, 20, soll_promille, RED, BLACK);
-	        my_lcd_draw_baargraph(10, 135, 200, 20, ist_promille, BLUE, BLACK);
+	        // Darstellen von Soll als Bargraph und Ist auf dem Drehzahlmesser
+	        my_lcd_bargraph_update(&soll_balken, soll_promille);
+	        my_lcd_dial_update(&ist_zeiger, ist);
+
+	        uint16_t verlauf_werte[2] = {soll_promille, ist_promille};
+	        my_lcd_rollchart_add(&verlauf, verlauf_werte);
 
 
 	        sprintf(buffer, "ADC Wert = %lu mV", potis_DMA_get_average_val_mv(0));
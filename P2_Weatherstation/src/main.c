@@ -26,6 +26,10 @@ int main(void) {
 	lcd_init();
 	//lcd_draw_text_at_line("BME280 Sensor Monitor", 0, BLACK, 2, WHITE);
 
+	// Gezeichnet wird in den Kachel-Puffer (ILI9341_SHADOW_ENABLE=1 in den Projekteinstellungen),
+	// lcd_flush() am Ende jedes Durchlaufs schickt nur die Kacheln, die sich geändert haben
+	lcd_compositor_begin();
+
 	sensor_gpio_init();
 	sensor_i2c_init();
 	sensor_bme280_init();
@@ -35,6 +39,19 @@ int main(void) {
 	float temp;
 	float hum;
 	float press;
+
+	// Balken merken sich ihre Füllbreite, pro Messung wird nur die Änderung gezeichnet
+	my_lcd_bargraph_t temp_balken;
+	my_lcd_bargraph_t press_balken;
+	my_lcd_bargraph_t hum_balken;
+	my_lcd_bargraph_init(&temp_balken, 20, 60, 110, 20, RED, YELLOW);
+	my_lcd_bargraph_init(&press_balken, 20, 110, 110, 20, BLUE, YELLOW);
+	my_lcd_bargraph_init(&hum_balken, 20, 160, 110, 20, GREEN, YELLOW);
+
+	// Luftdruckverlauf in 1/100 hPa, die Skala folgt den Messwerten
+	static my_lcd_stripchart_t press_verlauf;
+	my_lcd_stripchart_init(&press_verlauf, 20, 200, 200, 100, BLUE, BLACK, 0, 1, 1);
+
 	while (1) {
 		if (knoten_wechsel_mitJoystick()) {
 
@@ -47,6 +64,11 @@ int main(void) {
 			my_lcd_draw_baargraph(20, 60, 110, 20, 0, WHITE, WHITE);
 			my_lcd_draw_baargraph(20, 110, 110, 20, 0, WHITE, WHITE);
 			my_lcd_draw_baargraph(20, 160, 110, 20, 0, WHITE, WHITE);
+			my_lcd_bargraph_invalidate(&temp_balken);
+			my_lcd_bargraph_invalidate(&press_balken);
+			my_lcd_bargraph_invalidate(&hum_balken);
+			// neuer Knoten, neuer Verlauf
+			my_lcd_stripchart_clear(&press_verlauf);
 
 			// Flags zurücksetzen
 			temp_received = 0;
@@ -93,23 +115,23 @@ int main(void) {
 								1000 : (uint16_t) ((temp * 1000.0f) / 50.0f);
 				sprintf(temp_buffer, "%.2f C", temp);
 				lcd_draw_text_at_coord(temp_buffer, 140, 62, RED, 2, WHITE);
-				my_lcd_draw_baargraph(20, 60, 110, 20, temp_promille, RED,
-						YELLOW);
+				my_lcd_bargraph_update(&temp_balken, temp_promille);
 
 				char press_buffer[32];
 				uint16_t press_promille =
 						(press >= 1100.0f) ?
 								1000 : (uint16_t) ((press * 1000.0f) / 1100.0f);
-				my_lcd_draw_baargraph(20, 110, 110, 20, press_promille, BLUE,
-						YELLOW);
+				my_lcd_bargraph_update(&press_balken, press_promille);
 				sprintf(press_buffer, "%.2f hPa", press);
 				lcd_draw_text_at_coord(press_buffer, 140, 112, BLUE, 2, WHITE);
+				if (press > 0.0f) {
+					my_lcd_stripchart_add(&press_verlauf, (int32_t) (press * 100));
+				}
 
 				char hum_buffer[32];
 				uint16_t hum_promille =
 						(hum >= 100.0f) ? 1000 : (uint16_t) (hum * 10.0f);
-				my_lcd_draw_baargraph(20, 160, 110, 20, hum_promille, GREEN,
-						YELLOW);
+				my_lcd_bargraph_update(&hum_balken, hum_promille);
 				sprintf(hum_buffer, "%.2f %%", hum);
 				lcd_draw_text_at_coord(hum_buffer, 140, 162, GREEN, 2, WHITE);
 			}
@@ -117,5 +139,6 @@ int main(void) {
 			flag_send_data = 0; // reset flag
 
 		}
+		lcd_flush();
 	}
 }
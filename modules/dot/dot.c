@@ -9,10 +9,12 @@
  GPIO:
    - GPIOE: DOT-Segment
    - GPIOD: 7-Segment-Anzeige
-   - GPIOA / GPIOG: USER_TASTE / JOY_GPIO_PORT
+   - GPIOA / GPIOG: USER_TASTE (PA0 = TIM5_CH1) / JOY_GPIO_PORT
  TIMER:
-   - TIM1: Für DOT-Blinken, Dimming, Stoppuhr
+   - TIM1: Für DOT-Blinken, Dimming
    - TIM2: Für Treppenhausfunktion
+   - TIM5: Freilaufende 32-Bit-Zeitbasis der Stoppuhr (1 MHz), Kanal 1 Input Capture der USER-TASTE,
+           Kanal 2 Output Compare als 100-Hz-Takt der Anzeige, solange die Stoppuhr läuft
  ADC:
    - Extern über potis_DMA zur Steuerung von Frequenz und Helligkeit
 
@@ -48,17 +50,30 @@
 
  5. ***Stoppuhr mit Rundenmessung***
    (#) stopwatch_timer_init():
-       - Initialisiert Timer1 für 1 ms Tick (Interrupt)
+       - Startet Timer5 als freilaufenden 32-Bit-Zähler mit 1 MHz, Überlauf ohne Interrupt
+   (#) stopwatch_zeit_us():
+       - Liest den Zähler und erweitert ihn bei Überlauf auf 64 Bit (Mikrosekunden)
    (#) stopwatch_gpio_init():
-       - Konfiguriert USER-TASTE als EXTI0-Interrupt
-   (#) HAL_TIM_PeriodElapsedCallback():
-       - Inkrementiert zeitstand jede Millisekunde
-   (#) HAL_GPIO_EXTI_Callback():
-       - Setzt taste_gedrueckt-Flag bei Tastendruck (USER-TASTE)
+       - Legt USER-TASTE (PA0) auf TIM5_CH1
+   (#) stopwatch_capture_irq():
+       - Aus TIM5_IRQHandler: legt den in Hardware erfassten Zählerstand der Flanke
+         als 64-Bit-Zeitpunkt in den FIFO
+   (#) stopwatch_erfassung_holen():
+       - Holt den ältesten Zeitpunkt aus dem FIFO
+   (#) stopwatch_anzeige_irq():
+       - Aus TIM5_IRQHandler: zählt die Gesamtzeit der Anzeige als gepackte BCD-Ziffern
+         jede Hundertstelsekunde weiter
    (#) taste_verarbeiten():
-       - Startet Chrono oder speichert aktuelle Rundenzeit
+       - Startet Chrono oder speichert Rundenzeit zum erfassten Zeitpunkt im Rundenspeicher (runden.c)
    (#) gesamtdauer_anzeigen():
-       - Zeigt laufende Gesamtzeit + aktuelle Runde (wenn aktiv)
+       - Zeigt laufende Gesamtzeit, die sichtbare Seite der Rundenliste mit der laufenden Runde
+         sowie beste und mittlere Runde und das Delta zur vorherigen Runde
+       - Nutzt lcd_text_field_t, nur geänderte Zeichen werden neu gezeichnet
+       - Die Gesamtzeit kommt fertig als BCD aus der ISR, ohne Rechnen; ist sie seit dem
+         letzten Bild gleich geblieben (XOR = 0), wird sie nicht angefasst, sonst nur ab
+         der Zelle der höchsten geänderten Ziffer neu gezeichnet
+   (#) stopwatch_seite_blaettern():
+       - Blättert in der Rundenliste (RUNDEN_PRO_SEITE Runden pro Seite)
    (#) zeit_anzeigen_at():
        - Formatiert Zeit als MM:SS.CC und zeigt sie an
 
@@ -74,13 +89,14 @@
  * Globale Variablen
  */
 #include "stm32f4xx.h"
-#include <stdio.h>
 #include <lcd/lcd.h>
 #include "dot/dot.h"
 #include "potis_DMA/potis_DMA.h"
 #include "utils/utils.h"
 #include "median/median.h"
 #include "env_sensor/env_sensor.h"
+#include "runden/runden.h"
+#include "zeitformat/zeitformat.h"
 
 //TIM_HandleTypeDef tim_handle_struct;
 TIM_OC_InitTypeDef tim_oc_handle_struct;
@@ -91,14 +107,63 @@ uint32_t freq_mHz; // Dot frequenz
 /**
  * Private variablen
  */
-volatile uint32_t zeitstand = 0; // aktuelle zähler
-volatile uint32_t last_zeitstand = 0; // letzer Zähler-Wert
 volatile uint8_t chrono_laeuft= 0; //Zeigt an, ob die Stoppuhr läuft
-volatile uint32_t rundenzeiten[MAXIMALE_RUNDEN]; // Aufgezeichnete Zeiten für jede Runde
-volatile uint8_t runde_index = 0; // index aktueller Runde
-volatile uint32_t startzeit = 0; // Startzeit der Stoppuhr
-volatile uint32_t runden_startzeit = 0; // startzeit für jede Runde
-volatile uint8_t taste_gedrueckt = 0; // sagt ob die button gedrückt ist
+uint64_t startzeit = 0; // Startzeit der Stoppuhr in µs
+uint64_t runden_startzeit = 0; // startzeit für jede Runde in µs
+
+/**
+ * Zeitbasis der Stoppuhr: TIM5 zählt frei durch, die oberen 32 Bit werden beim Lesen nachgeführt
+ */
+static TIM_HandleTypeDef tim_handle_stopwatch;
+static uint32_t zeitbasis_letzter_stand = 0; // zuletzt gelesener Zählerstand
+static uint32_t zeitbasis_ueberlaeufe = 0; // Anzahl der Überläufe = obere 32 Bit
+
+/**
+ * FIFO der Tastendrücke: die ISR schreibt, die Hauptschleife liest. Die Indizes laufen frei
+ * über 8 Bit, der Füllstand ist ihre Differenz
+ */
+#define ERFASSUNG_FIFO_GROESSE 8 // Zweierpotenz
+static uint64_t erfassung_fifo[ERFASSUNG_FIFO_GROESSE]; // Zeitpunkte der Tastendrücke in µs
+static volatile uint8_t erfassung_schreiben = 0; // nur von der ISR verändert
+static volatile uint8_t erfassung_lesen = 0; // nur von der Hauptschleife verändert
+static uint64_t letzte_erfassung = 0; // Zeitpunkt des letzten angenommenen Tastendrucks
+static uint8_t erfassung_gueltig = 0; // letzte_erfassung ist gesetzt
+volatile uint16_t erfassungen_verloren = 0; // Tastendrücke, die bei vollem FIFO verworfen wurden
+
+/**
+ * Gesamtzeit der Anzeige als gepackte BCD-Ziffern 0xMMMMSSCC (zeitformat.h). Die ISR zählt sie
+ * auf den 10-ms-Grenzen seit startzeit weiter, die Hauptschleife liest sie nur. Ein Wort wird in
+ * einem Zug geschrieben und gelesen, jeder gelesene Wert ist also ein konsistenter Stand.
+ */
+#define ANZEIGE_TICK_US         (STOPWATCH_TIMER_FREQ_HZ / 100) // 10 ms
+#define ANZEIGE_TICK_RESERVE_US 5 // so knapp vor der nächsten Grenze wird erst die übernächste gestellt
+static volatile uint32_t anzeige_bcd = 0;
+static uint32_t letzte_bcd = 0xFFFFFFFF; // zuletzt gezeichnete BCD-Zeit, 0xFFFFFFFF = noch keine
+
+/**
+ * Textfelder der Stoppuhr, es werden nur geänderte Zeichen neu gezeichnet
+ */
+static lcd_text_field_t feld_chrono;
+static lcd_text_field_t feld_gesamt_label;
+static lcd_text_field_t feld_gesamt_zeit;
+static lcd_text_field_t feld_runde_label[RUNDEN_PRO_SEITE];
+static lcd_text_field_t feld_runde_zeit[RUNDEN_PRO_SEITE];
+static lcd_text_field_t feld_beste_label;
+static lcd_text_field_t feld_beste_zeit;
+static lcd_text_field_t feld_mittel_label;
+static lcd_text_field_t feld_mittel_zeit;
+static lcd_text_field_t feld_delta_label;
+static lcd_text_field_t feld_delta_zeit;
+static lcd_text_field_t feld_seite;
+static uint8_t felder_bereit = 0;
+
+/**
+ * Seiten der Rundenliste
+ */
+static uint32_t seite = 0; // angezeigte Seite
+static uint8_t seite_folgt = 1; // 1: die Liste zeigt immer die Seite der laufenden Runde
+static uint32_t liste_seite = 0xFFFFFFFF; // Seite der zuletzt gezeichneten Liste
+static uint32_t liste_anzahl = 0; // Anzahl der Runden bei der zuletzt gezeichneten Liste
 
 
 /**
@@ -335,107 +400,462 @@ void treppenhaus_init(){
 }
 
 /**
- * @brief Initialisiert Timer1 (und setzt seine Priority-Gruppe und subpriority) für Stoppuhr und aktiviert die Interrupt
+ * @brief Startet Timer5 als freilaufende 32-Bit-Zeitbasis der Stoppuhr und Kanal 1 als Input Capture der USER-TASTE
+ *
+ * TIM5 zählt mit STOPWATCH_TIMER_FREQ_HZ von 0 bis 0xFFFFFFFF und läuft dann über,
+ * ohne einen Interrupt auszulösen. Die Zeit wird erst beim Lesen aus dem Zählerstand
+ * berechnet (stopwatch_zeit_us()), die Auflösung ist 1 µs statt 10 ms.
+ *
+ * Die steigende Flanke an PA0 (TIM5_CH1) speichert den Zählerstand in Hardware in CCR1,
+ * erst danach löst sie den Capture-Interrupt aus. Die Rundenzeit hängt so nicht davon ab,
+ * wie lange die Hauptschleife gerade mit dem LCD beschäftigt ist.
  * @param None
  * @retval None
  */
 void stopwatch_timer_init(){
 
-	 __HAL_RCC_TIM1_CLK_ENABLE();
+	 __HAL_RCC_TIM5_CLK_ENABLE();
+
+	 // TIM5 hängt an APB1, mit APB1-Teiler > 1 läuft der Timertakt doppelt so schnell wie PCLK1
+	 uint32_t timer_takt = HAL_RCC_GetPCLK1Freq();
+	 if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_HCLK_DIV1) {
+		 timer_takt *= 2;
+	 }
+
+	 tim_handle_stopwatch.Instance = TIM5;
+	 tim_handle_stopwatch.Init.Prescaler = (timer_takt / STOPWATCH_TIMER_FREQ_HZ) - 1; // 1 MHz
+	 tim_handle_stopwatch.Init.Period = 0xFFFFFFFF; // freilaufend über die vollen 32 Bit
+	 tim_handle_stopwatch.Init.CounterMode = TIM_COUNTERMODE_UP;
+	 tim_handle_stopwatch.Init.ClockDivision = TIM_CLOCKDIVISION_DIV4; // fDTS = Timertakt / 4 für den Eingangsfilter
+	 tim_handle_stopwatch.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+	 tim_handle_stopwatch.Init.RepetitionCounter = 0;
+
+	 HAL_TIM_IC_Init(&tim_handle_stopwatch);
+
+	 // Digitaler Filter 0xF: die Flanke zählt erst nach 8 gleichen Abtastungen mit fDTS / 32
+	 TIM_IC_InitTypeDef tim_ic_init_struct;
+	 tim_ic_init_struct.ICPolarity = TIM_ICPOLARITY_RISING;
+	 tim_ic_init_struct.ICSelection = TIM_ICSELECTION_DIRECTTI;
+	 tim_ic_init_struct.ICPrescaler = TIM_ICPSC_DIV1;
+	 tim_ic_init_struct.ICFilter = 0xF;
+	 HAL_TIM_IC_ConfigChannel(&tim_handle_stopwatch, &tim_ic_init_struct, TIM_CHANNEL_1);
+
+	 // Kanal 2 vergleicht nur (kein Ausgang) und liefert den Takt der Anzeige, siehe anzeige_takt_starten()
+	 TIM_OC_InitTypeDef tim_oc_init_struct;
+	 tim_oc_init_struct.OCMode = TIM_OCMODE_TIMING;
+	 tim_oc_init_struct.Pulse = 0;
+	 tim_oc_init_struct.OCPolarity = TIM_OCPOLARITY_HIGH;
+	 tim_oc_init_struct.OCFastMode = TIM_OCFAST_DISABLE;
+	 HAL_TIM_OC_ConfigChannel(&tim_handle_stopwatch, &tim_oc_init_struct, TIM_CHANNEL_2);
+	 __HAL_TIM_DISABLE_IT(&tim_handle_stopwatch, TIM_IT_CC2);
+
+	 zeitbasis_letzter_stand = 0;
+	 zeitbasis_ueberlaeufe = 0;
+	 erfassung_lesen = erfassung_schreiben;
+	 erfassung_gueltig = 0;
+
+	 // startet den Timer, bis zum Start der Stoppuhr löst nur die Flanke an CH1 einen Interrupt aus
+	 HAL_NVIC_SetPriority(TIM5_IRQn, 0, 0);
+	 HAL_NVIC_EnableIRQ(TIM5_IRQn);
+	 HAL_TIM_IC_Start_IT(&tim_handle_stopwatch, TIM_CHANNEL_1);
+}
 
-	 tim_handle_struct.Instance = TIM1;
-	 tim_handle_struct.Init.Prescaler = (SystemCoreClock / 10000) - 1; // 10khz
-	 tim_handle_struct.Init.Period = 100 - 1; //1ms
-	 tim_handle_struct.Init.CounterMode = TIM_COUNTERMODE_UP;
-	 tim_handle_struct.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
-	 tim_handle_struct.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
-	 tim_handle_struct.Init.RepetitionCounter = 0;
+/**
+ * @brief Liefert die Zeit seit stopwatch_timer_init() in Mikrosekunden
+ *
+ * Ist der Zählerstand kleiner als beim letzten Lesen, ist TIM5 übergelaufen und
+ * die oberen 32 Bit werden erhöht. Das reicht, solange die Funktion mindestens
+ * einmal pro Überlauf (2^32 µs, etwa 71 Minuten) aufgerufen wird; die Hauptschleife
+ * der Stoppuhr tut das bei jedem Durchlauf. Die Interrupts sind dabei kurz
+ * gesperrt, damit die Funktion auch aus einer ISR aufgerufen werden darf.
+ * @param None
+ * @retval Zeit in µs
+ */
+uint64_t stopwatch_zeit_us(void) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
 
-	 HAL_TIM_Base_Init(&tim_handle_struct);
+    uint32_t stand = __HAL_TIM_GET_COUNTER(&tim_handle_stopwatch);
+    if (stand < zeitbasis_letzter_stand) {
+        zeitbasis_ueberlaeufe++;
+    }
+    zeitbasis_letzter_stand = stand;
+    uint64_t zeit = ((uint64_t)zeitbasis_ueberlaeufe << 32) | stand;
 
-	 // startet den Timer mit Interrupt
-	 HAL_TIM_Base_Start_IT(&tim_handle_struct);
-	 HAL_NVIC_SetPriority( TIM1_UP_TIM10_IRQn, 1, 1);
-	 HAL_NVIC_EnableIRQ(TIM1_UP_TIM10_IRQn);
+    __set_PRIMASK(primask);
+    return zeit;
 }
 
 /**
- * @brief Initialisiert GPIO für die USER-TASTE und setzt die Priority-Group und subpriority für den Interrunpt
+ * @brief Legt die USER-TASTE (PA0) als Alternate Function auf den Eingang TIM5_CH1
  * @param None
  * @retval None
  */
 void stopwatch_gpio_init(){
 
-	 __HAL_RCC_GPIOA_CLK_ENABLE(); //------------------- nur falls man einen andderen Buttons benutzen will stellen mit //----- ändern
+	 __HAL_RCC_GPIOA_CLK_ENABLE();
 
 		GPIO_InitTypeDef gpio_init_struct;
 
-		gpio_init_struct.Pin = USER_TASTE; // -------------
-		gpio_init_struct.Mode = GPIO_MODE_IT_RISING;
+		gpio_init_struct.Pin = USER_TASTE;
+		gpio_init_struct.Mode = GPIO_MODE_AF_PP;
 		gpio_init_struct.Pull = GPIO_NOPULL;
+		gpio_init_struct.Speed = GPIO_SPEED_LOW;
+		gpio_init_struct.Alternate = GPIO_AF2_TIM5;
 
-	HAL_GPIO_Init(USER_PORT, &gpio_init_struct); // ------------------
+	HAL_GPIO_Init(USER_PORT, &gpio_init_struct);
 
     HAL_NVIC_SetPriorityGrouping(NVIC_PRIORITYGROUP_0);
-	HAL_NVIC_SetPriority(EXTI0_IRQn , 0, 0); //------------
-	HAL_NVIC_EnableIRQ(EXTI0_IRQn); // --------------------
 
 }
 
 /**
- * @brief Timer-Interrupt Callback – zählt "Zähler" für Zeitmessung hoch
- * @param htim pointer auf eine struktur von typ TIM_HandleTypeDef
+ * @brief Capture-Interrupt der USER-TASTE, aus TIM5_IRQHandler aufzurufen
+ *
+ * Der erfasste 32-Bit-Zählerstand wird über den aktuellen 64-Bit-Zeitpunkt erweitert:
+ * die Flanke liegt (jetzt - CCR1) Ticks zurück, auch wenn der Zähler dazwischen übergelaufen ist.
+ * Flanken innerhalb von STOPWATCH_ENTPRELL_US nach dem letzten Tastendruck sind Prellen, ebenso
+ * Flanken, nach denen die Taste schon wieder losgelassen ist (Prellen beim Loslassen).
+ * @param None
+ * @retval None
+ */
+void stopwatch_capture_irq(void) {
+    if (!__HAL_TIM_GET_FLAG(&tim_handle_stopwatch, TIM_FLAG_CC1)) {
+        return;
+    }
+
+    uint32_t erfasst = __HAL_TIM_GET_COMPARE(&tim_handle_stopwatch, TIM_CHANNEL_1); // löscht CC1IF
+    __HAL_TIM_CLEAR_FLAG(&tim_handle_stopwatch, TIM_FLAG_CC1OF);
+
+    uint64_t jetzt = stopwatch_zeit_us();
+    uint64_t zeitpunkt = jetzt - (uint32_t)((uint32_t)jetzt - erfasst);
+
+    if (erfassung_gueltig && zeitpunkt - letzte_erfassung < STOPWATCH_ENTPRELL_US) {
+        return;
+    }
+    if (!(USER_PORT->IDR & USER_TASTE)) {
+        return;
+    }
+    letzte_erfassung = zeitpunkt;
+    erfassung_gueltig = 1;
+
+    uint8_t schreiben = erfassung_schreiben;
+    if ((uint8_t)(schreiben - erfassung_lesen) >= ERFASSUNG_FIFO_GROESSE) {
+        erfassungen_verloren++;
+        return;
+    }
+    erfassung_fifo[schreiben & (ERFASSUNG_FIFO_GROESSE - 1)] = zeitpunkt;
+    __DMB(); // Eintrag steht im Speicher, bevor der Index ihn freigibt
+    erfassung_schreiben = schreiben + 1;
+}
+
+/**
+ * @brief Holt den ältesten erfassten Tastendruck aus dem FIFO
+ * @param zeitpunkt Zeitpunkt des Tastendrucks in µs
+ * @retval 1 wenn ein Tastendruck vorlag, sonst 0
+ */
+uint8_t stopwatch_erfassung_holen(uint64_t* zeitpunkt) {
+    uint8_t lesen = erfassung_lesen;
+    if (lesen == erfassung_schreiben) {
+        return 0;
+    }
+    __DMB();
+    *zeitpunkt = erfassung_fifo[lesen & (ERFASSUNG_FIFO_GROESSE - 1)];
+    __DMB(); // Eintrag ist gelesen, bevor die ISR ihn überschreiben darf
+    erfassung_lesen = lesen + 1;
+    return 1;
+}
+
+/**
+ * @brief Compare-Interrupt des Anzeigetakts, aus TIM5_IRQHandler aufzurufen
+ *
+ * CCR2 wird um genau 10 ms weitergestellt, der Takt bleibt so auf den Grenzen seit startzeit,
+ * auch wenn der Interrupt später bedient wird. Die BCD-Zeit zählt mit Übertrag von Ziffer zu
+ * Ziffer eine Hundertstelsekunde weiter, ohne Division.
+ * @param None
  * @retval None
  */
-/*void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim){
+void stopwatch_anzeige_irq(void) {
+    if (!__HAL_TIM_GET_IT_SOURCE(&tim_handle_stopwatch, TIM_IT_CC2)
+            || !__HAL_TIM_GET_FLAG(&tim_handle_stopwatch, TIM_FLAG_CC2)) {
+        return;
+    }
 
-	if(htim->Instance == TIM1 ){
+    __HAL_TIM_CLEAR_FLAG(&tim_handle_stopwatch, TIM_FLAG_CC2);
+    __HAL_TIM_SET_COMPARE(&tim_handle_stopwatch, TIM_CHANNEL_2,
+            __HAL_TIM_GET_COMPARE(&tim_handle_stopwatch, TIM_CHANNEL_2) + ANZEIGE_TICK_US);
+    anzeige_bcd = zeitformat_bcd_naechste(anzeige_bcd);
+}
 
-		zeitstand++;
+/**
+ * @brief Legt beim ersten Aufruf die Textfelder der Stoppuhr an
+ * @param None
+ * @retval None
+ */
+static void felder_init(void) {
+    if (felder_bereit) {
+        return;
+    }
 
-	}
-}*/
+    lcd_text_field_init(&feld_chrono, 10, 10, BLACK, 2, WHITE);
+    lcd_text_field_init(&feld_gesamt_label, 10, 150, BLACK, 2, WHITE);
+    lcd_text_field_init(&feld_gesamt_zeit, 90, 150, BLACK, 2, WHITE);
+    for (uint8_t i = 0; i < RUNDEN_PRO_SEITE; i++) {
+        lcd_text_field_init(&feld_runde_label[i], 10, 30 + i * 20, BLACK, 2, WHITE);
+        lcd_text_field_init(&feld_runde_zeit[i], 95, 30 + i * 20, BLACK, 2, WHITE);
+    }
+    lcd_text_field_init(&feld_beste_label, 10, 170, BLACK, 2, WHITE);
+    lcd_text_field_init(&feld_beste_zeit, 90, 170, BLACK, 2, WHITE);
+    lcd_text_field_init(&feld_mittel_label, 10, 190, BLACK, 2, WHITE);
+    lcd_text_field_init(&feld_mittel_zeit, 90, 190, BLACK, 2, WHITE);
+    lcd_text_field_init(&feld_delta_label, 10, 270, BLACK, 2, WHITE);
+    lcd_text_field_init(&feld_delta_zeit, 90, 270, BLACK, 2, WHITE);
+    lcd_text_field_init(&feld_seite, 10, 290, BLACK, 2, WHITE);
+    felder_bereit = 1;
+}
 
 /**
- *  @brief EXTI Callback bei Usertaste – aktiviert das Flag taste_gedrueckt
- *  @param GPIO_Pin Pin der GPIO-PORT
- *  @retval None
+ * @brief Rechnet eine Zeit der Zeitbasis in Hundertstelsekunden für die Anzeige um
+ * @param us Zeit in µs
+ * @retval Zeit in Hundertstelsekunden
+ */
+static uint32_t us_in_hundertstel(uint64_t us) {
+    return zeitformat_us_in_hundertstel(us);
+}
+
+/**
+ * @brief Formatiert eine Zeit in Hundertstelsekunden als ": MM:SS.CC"
+ * @param hundertstel Zeit in Hundertstelsekunden
+ * @param ausgabe Zielpuffer mit mindestens ZEITFORMAT_PUFFER + 2 Zeichen
+ * @retval None
+ */
+static void zeit_formatieren(uint32_t hundertstel, char* ausgabe) {
+    ausgabe[0] = ':';
+    ausgabe[1] = ' ';
+    zeitformat_mm_ss_cc(ausgabe + 2, hundertstel);
+}
+
+/**
+ * @brief Formatiert eine vorzeichenbehaftete Zeitdifferenz als ": +MM:SS.CC" bzw. ": -MM:SS.CC"
+ * @param us Zeitdifferenz in µs
+ * @param ausgabe Zielpuffer mit mindestens ZEITFORMAT_PUFFER + 3 Zeichen
+ * @retval None
+ */
+static void delta_formatieren(int64_t us, char* ausgabe) {
+    ausgabe[0] = ':';
+    ausgabe[1] = ' ';
+    ausgabe[2] = (us < 0) ? '-' : '+';
+    zeitformat_mm_ss_cc(ausgabe + 3, us_in_hundertstel((us < 0) ? (uint64_t)-us : (uint64_t)us));
+}
+
+/**
+ * @brief Formatiert die Bezeichnung einer Runde als "Rd.N"
+ *
+ * Statt "Runde N:" wie früher: die Rundenzeit beginnt bei x=95, links davon ist Platz für
+ * 7 Zeichen zu 12 px. "Runde 10" hätte schon 8 und liefe in das Feld der Rundenzeit,
+ * "Rd.N" passt bis Runde 9999. Den Doppelpunkt bringt die Rundenzeit mit.
+ * @param nummer Nummer der Runde, 0 = erste Runde
+ * @param ausgabe Zielpuffer mit mindestens ZEITFORMAT_PUFFER + 3 Zeichen
+ * @retval None
+ */
+static void runde_bezeichnen(uint32_t nummer, char* ausgabe) {
+    ausgabe[0] = 'R';
+    ausgabe[1] = 'd';
+    ausgabe[2] = '.';
+    zeitformat_zahl(ausgabe + 3, nummer + 1);
+}
+
+/**
+ * @brief Zeigt Rundenbezeichnung und Rundenzeit in einer Zeile der Rundenliste an
+ * @param zeile Zeile auf der Seite
+ * @param nummer Nummer der Runde, 0 = erste Runde
+ * @param hundertstel Rundenzeit in Hundertstelsekunden
+ * @retval None
+ */
+static void runde_anzeigen(uint8_t zeile, uint32_t nummer, uint32_t hundertstel) {
+    char label[ZEITFORMAT_PUFFER + 3];
+    char ausgabe[ZEITFORMAT_PUFFER + 2];
+
+    runde_bezeichnen(nummer, label);
+    lcd_text_field_draw(&feld_runde_label[zeile], label);
+
+    zeit_formatieren(hundertstel, ausgabe);
+    lcd_text_field_draw(&feld_runde_zeit[zeile], ausgabe);
+}
+
+/**
+ * @brief Zeigt beste und mittlere Runde und das Delta der letzten Runde zur vorletzten an
+ * @param None
+ * @retval None
+ */
+static void statistik_anzeigen(void) {
+    const runden_statistik_t* statistik = runden_statistik();
+    char ausgabe[ZEITFORMAT_PUFFER + 3];
+
+    if (statistik->anzahl == 0) {
+        lcd_text_field_draw(&feld_beste_label, "");
+        lcd_text_field_draw(&feld_beste_zeit, "");
+        lcd_text_field_draw(&feld_mittel_label, "");
+        lcd_text_field_draw(&feld_mittel_zeit, "");
+        lcd_text_field_draw(&feld_delta_label, "");
+        lcd_text_field_draw(&feld_delta_zeit, "");
+        return;
+    }
+
+    lcd_text_field_draw(&feld_beste_label, "Beste");
+    zeit_formatieren(us_in_hundertstel(statistik->beste_us), ausgabe);
+    lcd_text_field_draw(&feld_beste_zeit, ausgabe);
+
+    lcd_text_field_draw(&feld_mittel_label, "Mittel");
+    zeit_formatieren(us_in_hundertstel(runden_mittel_us()), ausgabe);
+    lcd_text_field_draw(&feld_mittel_zeit, ausgabe);
+
+    if (statistik->anzahl > 1) {
+        lcd_text_field_draw(&feld_delta_label, "Delta");
+        delta_formatieren(statistik->delta_us, ausgabe);
+        lcd_text_field_draw(&feld_delta_zeit, ausgabe);
+    }
+}
+
+/**
+ * @brief Zeigt die sichtbare Seite der Rundenliste an
+ *
+ * Gezeichnet werden nur die RUNDEN_PRO_SEITE Zeilen der Seite, die abgeschlossenen Runden
+ * und die Statistik nur, wenn eine Runde dazugekommen ist oder die Seite gewechselt hat.
+ * Sonst ändert sich nur die laufende Runde. Der Aufwand hängt so nicht von der Anzahl der Runden ab.
+ * @param jetzt aktuelle Zeit in µs
+ * @retval None
  */
-/*void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin) {
+static void rundenliste_anzeigen(uint64_t jetzt) {
+    uint32_t anzahl = runden_anzahl();
 
-    if (GPIO_Pin == USER_TASTE) {
-    	taste_gedrueckt = 1;
+    if (seite_folgt) {
+        seite = anzahl / RUNDEN_PRO_SEITE;
     }
+    uint32_t erste = seite * RUNDEN_PRO_SEITE;
+
+    if (seite != liste_seite || anzahl != liste_anzahl) {
+        char ausgabe[ZEITFORMAT_PUFFER + 6];
+        runde_t runde;
+
+        for (uint8_t zeile = 0; zeile < RUNDEN_PRO_SEITE; zeile++) {
+            uint32_t nummer = erste + zeile;
+
+            if (nummer == anzahl) {
+                continue; // laufende Runde, siehe unten
+            }
+            if (runden_holen(nummer, &runde)) {
+                runde_anzeigen(zeile, nummer, us_in_hundertstel(runde.zeit_us));
+            } else if (nummer < anzahl) {
+                // weder im RAM-Ring noch im Log
+                runde_bezeichnen(nummer, ausgabe);
+                lcd_text_field_draw(&feld_runde_label[zeile], ausgabe);
+                lcd_text_field_draw(&feld_runde_zeit[zeile], ": --:--.--");
+            } else {
+                lcd_text_field_draw(&feld_runde_label[zeile], "");
+                lcd_text_field_draw(&feld_runde_zeit[zeile], "");
+            }
+        }
 
+        char seite_text[2 * ZEITFORMAT_PUFFER];
+        char* ende = seite_text;
+        for (const char* wort = "Seite "; *wort; wort++) {
+            *ende++ = *wort;
+        }
+        ende = zeitformat_zahl(ende, seite + 1);
+        *ende++ = '/';
+        zeitformat_zahl(ende, anzahl / RUNDEN_PRO_SEITE + 1);
+        lcd_text_field_draw(&feld_seite, seite_text);
+        statistik_anzeigen();
+
+        liste_seite = seite;
+        liste_anzahl = anzahl;
+    }
+
+    if (anzahl >= erste && anzahl < erste + RUNDEN_PRO_SEITE) {
+        runde_anzeigen(anzahl - erste, anzahl, us_in_hundertstel(jetzt - runden_startzeit));
+    }
+}
+
+/**
+ * @brief Startet den Anzeigetakt auf TIM5_CH2 phasengleich zum Start der Stoppuhr
+ *
+ * Der Start kann schon zurückliegen (Tastendruck aus dem FIFO), deshalb wird die BCD-Zeit
+ * einmal aus der verstrichenen Zeit gesetzt und CCR2 auf die nächste 10-ms-Grenze nach
+ * start gestellt. Liegt die Grenze so knapp, dass der Zähler sie vor dem Schreiben von
+ * CCR2 erreichen könnte, gilt die übernächste, sonst käme der erste Vergleich erst nach
+ * einem vollen Umlauf. Die Interrupts sind dabei gesperrt, damit BCD-Zeit und CCR2 zusammenpassen.
+ * @param start Startzeitpunkt der Stoppuhr in µs
+ * @retval None
+ */
+static void anzeige_takt_starten(uint64_t start) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    __HAL_TIM_DISABLE_IT(&tim_handle_stopwatch, TIM_IT_CC2);
+
+    uint64_t jetzt = stopwatch_zeit_us();
+    uint32_t hundertstel = us_in_hundertstel(jetzt - start);
+    uint64_t grenze = start + (uint64_t)(hundertstel + 1) * ANZEIGE_TICK_US;
+    if (grenze - jetzt < ANZEIGE_TICK_RESERVE_US) {
+        hundertstel++;
+        grenze += ANZEIGE_TICK_US;
+    }
+
+    anzeige_bcd = zeitformat_bcd_aus_hundertstel(hundertstel);
+    letzte_bcd = 0xFFFFFFFF;
+    __HAL_TIM_SET_COMPARE(&tim_handle_stopwatch, TIM_CHANNEL_2, (uint32_t)grenze);
+    __HAL_TIM_CLEAR_FLAG(&tim_handle_stopwatch, TIM_FLAG_CC2);
+    __HAL_TIM_ENABLE_IT(&tim_handle_stopwatch, TIM_IT_CC2);
+
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief Blättert in der Rundenliste
+ *
+ * Steht die Liste auf der letzten Seite, folgt sie der laufenden Runde auf neue Seiten.
+ * @param richtung -1 eine Seite zurück, 1 eine Seite vor
+ * @retval None
+ */
+void stopwatch_seite_blaettern(int8_t richtung) {
+    uint32_t letzte_seite = runden_anzahl() / RUNDEN_PRO_SEITE;
 
-}*/
+    if (seite_folgt) {
+        seite = letzte_seite;
+    }
+    if (richtung < 0 && seite > 0) {
+        seite--;
+    } else if (richtung > 0 && seite < letzte_seite) {
+        seite++;
+    }
+    seite_folgt = (seite == letzte_seite);
+}
 
 /**
  *  @brief Behandelt Tastendruck (USER_TASTE) – startet und speichert Rundenzeit
+ *
+ *  Die Zeitpunkte kommen aus dem Capture-FIFO, mehrere Tastendrücke während eines
+ *  langen Zeichenvorgangs werden nacheinander mit ihren eigenen Zeiten verarbeitet.
+ *  Die Runden gehen in den Rundenspeicher (runden.c), die Anzahl ist nicht begrenzt.
  *  @param None
  *  @retval None
  */
 void taste_verarbeitung() {
-    if (taste_gedrueckt) {
-        taste_gedrueckt = 0;
-
-        uint32_t jetzt = zeitstand;
+    felder_init();
 
+    uint64_t jetzt;
+    while (stopwatch_erfassung_holen(&jetzt)) {
         if (!chrono_laeuft) {
             chrono_laeuft = 1;
             startzeit = jetzt;
-            runde_index = 0;
             runden_startzeit  = jetzt;
-        } else if (runde_index < MAXIMALE_RUNDEN) {
-            uint32_t rundenzeit = jetzt - runden_startzeit;
-            rundenzeiten[runde_index] = rundenzeit;
-
-            char label[16];
-            snprintf(label, sizeof(label), "Runde %d:", runde_index + 1);
-            lcd_draw_text_at_coord(label, 10, 30 + runde_index * 20, BLACK, 2, WHITE);
-            zeit_anzeigen_at(rundenzeiten[runde_index], 95, 30 + runde_index * 20);
-
-            runde_index++;
+            runden_loeschen();
+            seite = 0;
+            seite_folgt = 1;
+            liste_seite = 0xFFFFFFFF;
+            anzeige_takt_starten(startzeit);
+        } else {
+            runden_hinzufuegen(jetzt - runden_startzeit);
             runden_startzeit  = jetzt;
         }
     }
@@ -445,25 +865,42 @@ void taste_verarbeitung() {
 
 /**
  * @brief Zeigt fortlaufend die verstrichene Gesamtzeit auf dem Display an
+ *
+ * Die Texte liegen in Textfeldern, pro Aufruf werden nur die geänderten
+ * Zeichen (meist die letzte Ziffer) zum Display geschickt.
+ * Die Gesamtzeit zählt stopwatch_anzeige_irq() als BCD-Ziffern mit; hier wird sie nur
+ * gelesen und mit dem letzten Bild verglichen, die Ziffern werden ohne Rechnen ausgegeben.
+ * Das höchste Halbbyte des XOR ergibt die erste geänderte Zeichenzelle, ab ihr wird das
+ * Feld ohne Zeichenvergleich neu gezeichnet (lcd_text_field_draw_from()).
  * @param None
  * @retval None
  */
 void gesamtdauer_anzeigen() {
-    if (chrono_laeuft) {
-        uint32_t jetzt = zeitstand;
-        uint32_t vergangene_zeit = jetzt - startzeit;
-
-        lcd_draw_text_at_coord("Gesamt:", 10, 150, BLACK, 2, WHITE);
-        zeit_anzeigen_at(vergangene_zeit, 90, 150);
+    felder_init();
 
-        if (runde_index < MAXIMALE_RUNDEN) {
-            char label[16];
-            snprintf(label, sizeof(label), "Runde %d:", runde_index + 1);
-            lcd_draw_text_at_coord(label, 10, 30 + runde_index * 20, BLACK, 2, WHITE);
-
-            uint32_t aktuelle_rundenzeit = jetzt - runden_startzeit ;
-            zeit_anzeigen_at(aktuelle_rundenzeit, 95, 30 + runde_index * 20);
+    if (chrono_laeuft) {
+        uint64_t jetzt = stopwatch_zeit_us();
+        uint32_t bcd = anzeige_bcd; // ein Lesezugriff, konsistenter Stand
+        uint32_t geaendert = bcd ^ letzte_bcd; // ein Halbbyte ungleich 0 pro geänderter Ziffer
+
+        lcd_text_field_draw(&feld_chrono, "Chrono laeuft");
+        lcd_text_field_draw(&feld_gesamt_label, "Gesamt:");
+        if (geaendert) {
+            char ausgabe[ZEITFORMAT_PUFFER + 2];
+
+            ausgabe[0] = ':';
+            ausgabe[1] = ' ';
+            uint8_t laenge = zeitformat_bcd_mm_ss_cc(ausgabe + 2, bcd) - ausgabe;
+
+            // höchste geänderte Ziffer: Halbbyte k von unten; vom Ende her stehen davor noch
+            // k Ziffern, dazu '.' ab den Sekunden und ':' ab den Minuten
+            uint8_t k = (31 - __CLZ(geaendert)) / 4;
+            uint8_t zelle = laenge - 1 - k - (k >= 2) - (k >= 4);
+            lcd_text_field_draw_from(&feld_gesamt_zeit, ausgabe, zelle);
+            letzte_bcd = bcd;
         }
+
+        rundenliste_anzeigen(jetzt);
     }
 }
 
@@ -483,12 +920,8 @@ void gesamtdauer_anzeigen() {
  * "Chrono läuft" oben auf dem Bildschirm angezeigt.
  */
 void zeit_anzeigen_at(uint32_t hundertstel, uint16_t x, uint16_t y) {
-    uint32_t minuten = hundertstel / 6000;
-    uint32_t sekunden = (hundertstel % 6000) / 100;
-    uint32_t zehntelsek = hundertstel % 100;
-
-    char ausgabe[16];
-    snprintf(ausgabe, sizeof(ausgabe), ": %02lu:%02lu.%02lu", minuten, sekunden, zehntelsek);
+    char ausgabe[ZEITFORMAT_PUFFER + 2];
+    zeit_formatieren(hundertstel, ausgabe);
     lcd_draw_text_at_coord(ausgabe, x, y, BLACK, 2, WHITE);
 
     if (chrono_laeuft) {
@@ -39,21 +39,19 @@
 
 
 #define DOT_TIMER_FREQ_HZ       10000U    // Timer Frequenz 10 kHz
+#define STOPWATCH_TIMER_FREQ_HZ 1000000U  // Zeitbasis der Stoppuhr 1 MHz, 1 Tick = 1 µs
+#define STOPWATCH_ENTPRELL_US   20000U    // Flanken so kurz nach einem Tastendruck werden als Prellen verworfen
 #define POTIS_VREF_MV 3300U // referenz Spannung
 
-#define MAXIMALE_RUNDEN 6 // Anzahl erlaubten Rundenzeiten kann verändert werden
+#define RUNDEN_PRO_SEITE 6 // Zeilen der Rundenliste auf dem LCD, die Anzahl der Runden ist nicht begrenzt
 
 /**
  * Externe Variablen
  */
-extern volatile uint32_t zeitstand; // aktuelle zähler
-extern volatile uint32_t last_zeitstand; // letzer Zähler-Wert
 extern volatile uint8_t chrono_laeuft; //Zeigt an, ob die Stoppuhr läuft
-extern volatile uint32_t runden_zeiten[MAXIMALE_RUNDEN]; // Aufgezeichnete Zeiten für jede Runde
-extern volatile uint8_t runde_index; // index aktueller Runde
-extern volatile uint32_t startzeit; // Startzeit der Stoppuhr
-extern volatile uint32_t runden_startzeit; // startzeit für jede Runde
-extern volatile uint8_t taste_gedrueckt; // sagt ob die button gedrückt ist
+extern uint64_t startzeit; // Startzeit der Stoppuhr in µs
+extern uint64_t runden_startzeit; // startzeit für jede Runde in µs
+extern volatile uint16_t erfassungen_verloren; // Tastendrücke, die bei vollem FIFO verworfen wurden
 
 extern TIM_HandleTypeDef tim_handle_struct;
 
@@ -75,9 +73,14 @@ void treppenhaus_init();
 
 
 void stopwatch_timer_init();
+uint64_t stopwatch_zeit_us(void);
 void stopwatch_gpio_init();
+void stopwatch_capture_irq(void);
+uint8_t stopwatch_erfassung_holen(uint64_t* zeitpunkt);
+void stopwatch_anzeige_irq(void);
 void zeit_anzeigen_at(uint32_t total_centiemes, uint16_t x, uint16_t y);
 void dessine_boutons();
 void gesamtdauer_anzeigen();
 void taste_verarbeitung();
+void stopwatch_seite_blaettern(int8_t richtung);
 #endif /* DOT_DOT_H_ */
@@ -0,0 +1,210 @@
+//-----------------------------------
+//	ILI9341 glyph atlases
+//-----------------------------------
+//
+//	See ILI9341_Font.h. The atlases themselves are generated into fonts/ by tools/lcd_font.
+//
+//-----------------------------------
+
+#include <lcd/ILI9341_Font.h>
+#include <lcd/ILI9341_STM32_Driver.h>
+#include <lcd/ILI9341_Queue.h>
+#include <string.h>
+
+/*Returns the atlas ILI9341_Draw_Text uses for a text size, 0 if the size is expanded at runtime*/
+const ILI9341_Font* ILI9341_Get_Font(uint16_t Size)
+{
+#if ILI9341_FONT_ATLAS
+	if(Size == 2) return &ILI9341_Font_Fixed_2;
+	if(Size == 3) return &ILI9341_Font_Fixed_3;
+#endif
+	(void)Size;
+	return 0;
+}
+
+/*Glyph of a character, characters the font does not have are drawn as '?'*/
+static const ILI9341_Font_Glyph* ILI9341_Font_Get_Glyph(const ILI9341_Font* Font, char Character)
+{
+	uint8_t Index = (uint8_t)Character - (uint8_t)Font->First;
+
+	if(Index >= Font->Count) Index = (uint8_t)'?' - (uint8_t)Font->First;
+	return &Font->Glyphs[Index];
+}
+
+/*Returns the pixels Second moves by when it follows First*/
+int8_t ILI9341_Get_Kerning(const ILI9341_Font* Font, char First, char Second)
+{
+	uint16_t Pair = (uint16_t)((uint8_t)First<<8 | (uint8_t)Second);
+	uint16_t Low = 0;
+	uint16_t High = Font->Kern_Count;
+
+	//BINARY SEARCH, THE TABLE IS SORTED BY THE PAIR
+	while(Low < High)
+	{
+		uint16_t Middle = (Low+High)/2;
+		const ILI9341_Font_Kern* Kern = &Font->Kerns[Middle];
+		uint16_t Entry = (uint16_t)((uint8_t)Kern->First<<8 | (uint8_t)Kern->Second);
+
+		if(Entry == Pair) return Kern->Adjust;
+		if(Entry < Pair) Low = Middle+1;
+		else High = Middle;
+	}
+	return 0;
+}
+
+/*Returns the width of the first Length characters of Text, including kerning*/
+uint16_t ILI9341_Get_Text_Width(const ILI9341_Font* Font, const char* Text, uint16_t Length)
+{
+	uint16_t Width = 0;
+
+	for(uint16_t i = 0; i < Length; i++)
+	{
+		Width += ILI9341_Font_Get_Glyph(Font, Text[i])->Advance;
+		if(i+1 < Length) Width += ILI9341_Get_Kerning(Font, Text[i], Text[i+1]);
+	}
+	return Width;
+}
+
+/*Prepares Run for Length characters of Text in a window of Width x Height pixels*/
+/*Text is read while the run is rendered, it has to stay unchanged until then*/
+void ILI9341_Text_Run_Init(ILI9341_Text_Run* Run, const ILI9341_Font* Font, const char* Text, uint16_t Length, uint16_t Width, uint16_t Height, uint16_t Colour, uint16_t Background_Colour)
+{
+	Run->Font = Font;
+	Run->Text = Text;
+	Run->Length = Length;
+	Run->Width = Width;
+	Run->Height = Height;
+	Run->Colours[0] = Background_Colour;
+	Run->Colours[1] = Colour;
+	Run->Row = 0;
+	Run->Column = 0;
+	Run->Line_Row = 0xFF;
+}
+
+/*ORs bitmap row Bitmap_Row of every visible character into the line of the run*/
+static void ILI9341_Text_Run_Line(ILI9341_Text_Run* Run, uint8_t Bitmap_Row)
+{
+	const ILI9341_Font* Font = Run->Font;
+	int16_t X = 0;
+
+	memset(Run->Line, 0, sizeof(Run->Line));
+	for(uint16_t i = 0; (i < Run->Length) && (X < Run->Width); i++)
+	{
+		const ILI9341_Font_Glyph* Glyph = ILI9341_Font_Get_Glyph(Font, Run->Text[i]);
+		uint8_t Bytes = (Glyph->Width+7)/8;
+		const uint8_t* Bits = Font->Bitmaps + Glyph->Offset + Bitmap_Row*Bytes;
+		uint8_t* Line = &Run->Line[X/8];
+		uint8_t Shift = X & 7;
+
+		if(X/8 + Bytes >= ILI9341_FONT_LINE_BYTES) Bytes = ILI9341_FONT_LINE_BYTES-1 - X/8;
+		for(uint8_t k = 0; k < Bytes; k++)
+		{
+			Line[k] |= Bits[k] >> Shift;
+			Line[k+1] |= (uint8_t)(Bits[k] << (8-Shift));
+		}
+
+		X += Glyph->Advance;
+		if(i+1 < Run->Length) X += ILI9341_Get_Kerning(Font, Run->Text[i], Run->Text[i+1]);
+	}
+}
+
+/*Renders the next pixels of the run into Buffer, up to BURST_MAX_PIXELS, row by row*/
+/*Returns their number, 0 when the run is complete*/
+uint16_t ILI9341_Render_Text(ILI9341_Text_Run* Run, uint16_t* Buffer)
+{
+	const uint16_t* Colours = Run->Colours;
+	const uint8_t* Line = Run->Line;
+	uint16_t Width = Run->Width;
+	uint16_t Count = 0;
+
+	while((Count < BURST_MAX_PIXELS) && (Run->Row < Run->Height))
+	{
+		uint8_t Bitmap_Row = Run->Row/Run->Font->Scale;
+		if(Bitmap_Row != Run->Line_Row)
+		{
+			ILI9341_Text_Run_Line(Run, Bitmap_Row);
+			Run->Line_Row = Bitmap_Row;
+		}
+		else if((Run->Column == 0) && (Count >= Width) && (Count+Width <= BURST_MAX_PIXELS))
+		{
+			//SAME BITMAP ROW AS THE ROW JUST RENDERED, COPY IT
+			memcpy(&Buffer[Count], &Buffer[Count-Width], Width*sizeof(uint16_t));
+			Count += Width;
+			Run->Row++;
+			continue;
+		}
+
+		uint16_t Column = Run->Column;
+		uint16_t End = Width;
+		if(End-Column > BURST_MAX_PIXELS-Count) End = Column+BURST_MAX_PIXELS-Count;
+
+		//THE BIT OF THE PIXEL SELECTS ITS COLOUR, WHOLE BYTES OF THE LINE EIGHT PIXELS AT A TIME
+		while(Column < End)
+		{
+			if(((Column & 7) == 0) && (Column+8 <= End))
+			{
+				uint8_t Bits = Line[Column>>3];
+				uint16_t* Pixel = &Buffer[Count];
+
+				Pixel[0] = Colours[Bits>>7];
+				Pixel[1] = Colours[(Bits>>6) & 1];
+				Pixel[2] = Colours[(Bits>>5) & 1];
+				Pixel[3] = Colours[(Bits>>4) & 1];
+				Pixel[4] = Colours[(Bits>>3) & 1];
+				Pixel[5] = Colours[(Bits>>2) & 1];
+				Pixel[6] = Colours[(Bits>>1) & 1];
+				Pixel[7] = Colours[Bits & 1];
+				Count += 8;
+				Column += 8;
+				continue;
+			}
+			Buffer[Count++] = Colours[(Line[Column>>3] >> (~Column & 7)) & 1];
+			Column++;
+		}
+
+		Run->Column = End;
+		if(End == Width)
+		{
+			Run->Column = 0;
+			Run->Row++;
+		}
+	}
+	return Count;
+}
+
+//DRAW A TEXT WITH AN ATLAS FONT, ITS UPPER LEFT CORNER AT X,Y
+//
+//The whole text including its background goes through one address window,
+//one transmit buffer is rendered while the other one is on the wire
+//
+void ILI9341_Draw_Text_Font(const ILI9341_Font* Font, const char* Text, uint16_t X, uint16_t Y, uint16_t Colour, uint16_t Background_Colour)
+{
+	uint16_t Length = strlen(Text);
+
+	if((X >= LCD_WIDTH) || (Y >= LCD_HEIGHT) || (Length == 0)) return;
+
+	if(ILI9341_Queue_Active)
+	{
+		ILI9341_Queue_Text(Font, Text, Length, X, Y, Colour, 0, Background_Colour);
+		return;
+	}
+
+	//CLIP THE TEXT AT THE SCREEN EDGES
+	uint16_t Width = ILI9341_Get_Text_Width(Font, Text, Length);
+	uint16_t Height = Font->Height;
+	if(X+Width > LCD_WIDTH) Width = LCD_WIDTH-X;
+	if(Y+Height > LCD_HEIGHT) Height = LCD_HEIGHT-Y;
+
+	ILI9341_Set_Address(X, Y, X+Width-1, Y+Height-1);
+
+	ILI9341_Text_Run Run;
+	uint16_t* Buffer = ILI9341_Get_Tx_Buffer();
+	uint16_t Count;
+
+	ILI9341_Text_Run_Init(&Run, Font, Text, Length, Width, Height, Colour, Background_Colour);
+	while((Count = ILI9341_Render_Text(&Run, Buffer)) != 0)
+	{
+		ILI9341_Send_Tx_Buffer(Buffer, Count, 1, 0);
+		Buffer = ILI9341_Get_Tx_Buffer();
+	}
+}
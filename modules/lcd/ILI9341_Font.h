@@ -0,0 +1,86 @@
+//-----------------------------------
+//	ILI9341 glyph atlases
+//-----------------------------------
+//
+//	An ILI9341_Font is the 5x5 font of 5x5_font.h already scaled to one text size and packed as const
+//	tables in flash. tools/lcd_font generates them, see tools/lcd_font/README.md:
+//
+//	ILI9341_Font_Fixed_2/_3	Cells of 6 columns, pixel for pixel what ILI9341_Draw_Char draws at size 2/3.
+//							ILI9341_Draw_Text and ILI9341_Draw_Char use them for these sizes.
+//	ILI9341_Font_Prop_2/_3	Proportional widths, tabular digits and kerning of letters and punctuation.
+//
+//	Every glyph stores its Height/Scale rows of Width bits, (Width+7)/8 bytes per row, the leftmost pixel in
+//	bit 7. A text is drawn through one address window: for each row of the font the bits of all its glyphs
+//	are ORed into a line at their (kerned) positions, then the line is turned into pixels with a lookup of
+//	{Background_Colour, Colour}, without a branch per pixel. The line is reused for the Scale rows it covers.
+//
+//-----------------------------------
+
+#ifndef ILI9341_FONT_H
+#define ILI9341_FONT_H
+
+#include "stm32f4xx_hal.h"
+
+//0 DRAWS ALL TEXT SIZES WITH THE GLYPH EXPANSION OF ILI9341_GFX AND LEAVES THE ATLASES OUT
+#ifndef ILI9341_FONT_ATLAS
+#define ILI9341_FONT_ATLAS			1
+#endif
+
+//BYTES OF A RENDERED LINE: THE LONGEST SCREEN SIDE PLUS A GLYPH THAT STARTS AT ITS LAST PIXEL
+#define ILI9341_FONT_LINE_BYTES		(320/8+8)
+
+typedef struct
+{
+	uint16_t Offset;			//FIRST BYTE OF THE ROWS IN Bitmaps
+	uint8_t Width;				//PIXELS PER ROW
+	uint8_t Advance;			//PIXELS TO THE START OF THE NEXT CHARACTER, WITHOUT KERNING
+} ILI9341_Font_Glyph;
+
+typedef struct
+{
+	char First;
+	char Second;
+	int8_t Adjust;				//ADDED TO THE ADVANCE OF First WHEN Second FOLLOWS
+} ILI9341_Font_Kern;
+
+typedef struct
+{
+	uint8_t Height;				//PIXEL ROWS OF EVERY CHARACTER
+	uint8_t Scale;				//EACH ROW OF THE BITMAPS IS SHOWN Scale TIMES
+	char First;					//CHARACTER OF Glyphs[0]
+	uint8_t Count;
+	const ILI9341_Font_Glyph* Glyphs;
+	const uint8_t* Bitmaps;
+	uint16_t Kern_Count;
+	const ILI9341_Font_Kern* Kerns;	//SORTED BY First, THEN Second
+} ILI9341_Font;
+
+//POSITION IN A TEXT, LETS THE DISPLAY LIST RENDER IT ONE BLOCK PER DMA INTERRUPT
+typedef struct
+{
+	const ILI9341_Font* Font;
+	const char* Text;
+	uint16_t Length;
+	uint16_t Width;				//CLIPPED WINDOW
+	uint16_t Height;
+	uint16_t Colours[2];		//BACKGROUND, TEXT
+	uint16_t Row;				//NEXT PIXEL
+	uint16_t Column;
+	uint8_t Line_Row;			//BITMAP ROW HELD IN Line
+	uint8_t Line[ILI9341_FONT_LINE_BYTES];
+} ILI9341_Text_Run;
+
+extern const ILI9341_Font ILI9341_Font_Fixed_2;
+extern const ILI9341_Font ILI9341_Font_Fixed_3;
+extern const ILI9341_Font ILI9341_Font_Prop_2;
+extern const ILI9341_Font ILI9341_Font_Prop_3;
+
+const ILI9341_Font* ILI9341_Get_Font(uint16_t Size);
+uint16_t ILI9341_Get_Text_Width(const ILI9341_Font* Font, const char* Text, uint16_t Length);
+int8_t ILI9341_Get_Kerning(const ILI9341_Font* Font, char First, char Second);
+void ILI9341_Draw_Text_Font(const ILI9341_Font* Font, const char* Text, uint16_t X, uint16_t Y, uint16_t Colour, uint16_t Background_Colour);
+
+void ILI9341_Text_Run_Init(ILI9341_Text_Run* Run, const ILI9341_Font* Font, const char* Text, uint16_t Length, uint16_t Width, uint16_t Height, uint16_t Colour, uint16_t Background_Colour);
+uint16_t ILI9341_Render_Text(ILI9341_Text_Run* Run, uint16_t* Buffer);
+
+#endif
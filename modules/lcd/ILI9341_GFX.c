@@ -48,77 +48,23 @@
 #include <lcd/5x5_font.h>
 #include <lcd/ILI9341_GFX.h>
 #include <lcd/ILI9341_STM32_Driver.h>
+#include <lcd/ILI9341_Queue.h>
+#include <lcd/ILI9341_Font.h>
+#include <lcd/ILI9341_Shapes.h>
+#include <string.h>
 
 /*Draw hollow circle at X,Y location with specified radius and colour. X and Y represent circles center */
+/*Points that share a column or row within one octant are sent as one span instead of single pixels*/
 void ILI9341_Draw_Hollow_Circle(uint16_t X, uint16_t Y, uint16_t Radius, uint16_t Colour)
 {
-	int x = Radius-1;
-    int y = 0;
-    int dx = 1;
-    int dy = 1;
-    int err = dx - (Radius << 1);
-
-    while (x >= y)
-    {
-        ILI9341_Draw_Pixel(X + x, Y + y, Colour);
-        ILI9341_Draw_Pixel(X + y, Y + x, Colour);
-        ILI9341_Draw_Pixel(X - y, Y + x, Colour);
-        ILI9341_Draw_Pixel(X - x, Y + y, Colour);
-        ILI9341_Draw_Pixel(X - x, Y - y, Colour);
-        ILI9341_Draw_Pixel(X - y, Y - x, Colour);
-        ILI9341_Draw_Pixel(X + y, Y - x, Colour);
-        ILI9341_Draw_Pixel(X + x, Y - y, Colour);
-
-        if (err <= 0)
-        {
-            y++;
-            err += dy;
-            dy += 2;
-        }
-        if (err > 0)
-        {
-            x--;
-            dx += 2;
-            err += (-Radius << 1) + dx;
-        }
-    }
+	ILI9341_Draw_Round_Outline(X, Y, X, Y, Radius, Colour);
 }
 
 /*Draw filled circle at X,Y location with specified radius and colour. X and Y represent circles center */
+/*Each row of the circle is sent once as a horizontal span, about 2*Radius spans in total*/
 void ILI9341_Draw_Filled_Circle(uint16_t X, uint16_t Y, uint16_t Radius, uint16_t Colour)
 {
-	
-		int x = Radius;
-    int y = 0;
-    int xChange = 1 - (Radius << 1);
-    int yChange = 0;
-    int radiusError = 0;
-
-    while (x >= y)
-    {
-        for (int i = X - x; i <= X + x; i++)
-        {
-            ILI9341_Draw_Pixel(i, Y + y,Colour);
-            ILI9341_Draw_Pixel(i, Y - y,Colour);
-        }
-        for (int i = X - y; i <= X + y; i++)
-        {
-            ILI9341_Draw_Pixel(i, Y + x,Colour);
-            ILI9341_Draw_Pixel(i, Y - x,Colour);
-        }
-
-        y++;
-        radiusError += yChange;
-        yChange += 2;
-        if (((radiusError << 1) + xChange) > 0)
-        {
-            x--;
-            radiusError += xChange;
-            xChange += 2;
-        }
-    }
-		//Really slow implementation, will require future overhaul
-		//TODO:	https://stackoverflow.com/questions/1201200/fast-algorithm-for-drawing-filled-circles	
+	ILI9341_Draw_Round_Fill(X, Y, X, Y, Radius, Colour);
 }
 
 /*Draw a hollow rectangle between positions X0,Y0 and X1,Y1 with specified colour*/
@@ -218,144 +164,228 @@ void ILI9341_Draw_Filled_Rectangle_Coord(uint16_t X0, uint16_t Y0, uint16_t X1,
 	ILI9341_Draw_Rectangle(X0_true, Y0_true, X_length, Y_length, Colour);	
 }
 
+//GLYPH CACHE
+//
+//Glyphs are kept as row masks, bit n set = column n of the (scaled) cell is lit
+//Sizes with an atlas (see ILI9341_Font.h) never get here. Without atlases sizes 2 and 3 are expanded
+//once and kept in a small cache, other sizes are expanded on every call
+//
+
+#define GLYPH_CACHE_ENTRIES		16
+#define GLYPH_CACHE_MIN_SIZE	2
+#define GLYPH_CACHE_MAX_SIZE	3
+#define GLYPH_MAX_SIZE			(32/CHAR_WIDTH)
+
+typedef struct
+{
+	uint8_t Character;
+	uint8_t Size;
+	uint32_t Rows[CHAR_HEIGHT];
+} ILI9341_Glyph;
+
+#if !ILI9341_FONT_ATLAS
+static ILI9341_Glyph Glyph_Cache[GLYPH_CACHE_ENTRIES];
+static uint8_t Glyph_Cache_Next = 0;
+#endif
+static ILI9341_Glyph Glyph_Scratch;
+
+/*Expands font entry Index horizontally by Size into Glyph*/
+static void ILI9341_Expand_Glyph(ILI9341_Glyph* Glyph, uint8_t Index, uint8_t Size)
+{
+	Glyph->Character = Index;
+	Glyph->Size = Size;
+	for(uint8_t i = 0; i < CHAR_HEIGHT; i++)
+	{
+		uint32_t Mask = 0;
+		for(uint8_t j = 0; j < CHAR_WIDTH; j++)
+		{
+			if(font[Index][j] & (1<<i))
+			{
+				Mask |= ((1UL<<Size)-1) << (j*Size);
+			}
+		}
+		Glyph->Rows[i] = Mask;
+	}
+}
+
+/*Returns the expanded glyph for font entry Index, cached for the common text sizes*/
+static const ILI9341_Glyph* ILI9341_Get_Glyph(uint8_t Index, uint8_t Size)
+{
+#if !ILI9341_FONT_ATLAS
+	if((Size >= GLYPH_CACHE_MIN_SIZE) && (Size <= GLYPH_CACHE_MAX_SIZE))
+	{
+		for(uint8_t k = 0; k < GLYPH_CACHE_ENTRIES; k++)
+		{
+			if((Glyph_Cache[k].Size == Size) && (Glyph_Cache[k].Character == Index))
+			{
+				return &Glyph_Cache[k];
+			}
+		}
+
+		//MISS, REPLACE ENTRIES ROUND ROBIN
+		ILI9341_Glyph* Glyph = &Glyph_Cache[Glyph_Cache_Next];
+		Glyph_Cache_Next = (Glyph_Cache_Next + 1) % GLYPH_CACHE_ENTRIES;
+		ILI9341_Expand_Glyph(Glyph, Index, Size);
+		return Glyph;
+	}
+#endif
+
+	ILI9341_Expand_Glyph(&Glyph_Scratch, Index, Size);
+	return &Glyph_Scratch;
+}
+
+/*Font entry of a character, control characters map onto the first entries*/
+static uint8_t ILI9341_Font_Index(char Character)
+{
+	uint8_t function_char = Character;
+
+	if (function_char >= ' ') function_char -= 32;
+	return function_char;
+}
+
+/*Renders rows First_Row... of a character cell Width pixels wide into Buffer, as many as fit into BURST_MAX_PIXELS*/
+/*Returns the number of rows, Height is the clipped cell height*/
+uint16_t ILI9341_Render_Char_Rows(char Character, uint16_t Size, uint16_t Colour, uint16_t Background_Colour, uint16_t Width, uint16_t Height, uint16_t First_Row, uint16_t* Buffer)
+{
+	const ILI9341_Glyph* Glyph = ILI9341_Get_Glyph(ILI9341_Font_Index(Character), Size);
+	uint16_t Rows_Per_Block = BURST_MAX_PIXELS/Width;
+	uint16_t Row = First_Row;
+	uint16_t Buffer_Counter = 0;
+
+	for(uint16_t k = 0; (k < Rows_Per_Block) && (Row < Height); k++, Row++)
+	{
+		uint32_t Mask = Glyph->Rows[Row/Size];
+		for(uint16_t Column = 0; Column < Width; Column++)
+		{
+			Buffer[Buffer_Counter++] = (Mask & (1UL<<Column)) ? Colour : Background_Colour;
+		}
+	}
+	return Row - First_Row;
+}
+
 /*Draws a character (fonts imported from fonts.h) at X,Y location with specified font colour, size and Background colour*/
 /*See fonts.h implementation of font on what is required for changing to a different font when switching fonts libraries*/
-void ILI9341_Draw_Char(char Character, uint8_t X, uint8_t Y, uint16_t Colour, uint16_t Size, uint16_t Background_Colour) 
+/*The whole cell including its background is rendered into the transmit buffers and sent through one address window*/
+void ILI9341_Draw_Char(char Character, uint16_t X, uint16_t Y, uint16_t Colour, uint16_t Size, uint16_t Background_Colour) 
 {
 		uint8_t 	function_char;
     uint8_t 	i,j;
 		
-		function_char = Character;
-		
-    if (function_char < ' ') {
-        Character = 0;
-    } else {
-        function_char -= 32;
+		function_char = ILI9341_Font_Index(Character);
+
+		if((X >= LCD_WIDTH) || (Y >= LCD_HEIGHT) || (Size == 0)) return;
+
+		const ILI9341_Font* Font = ILI9341_Get_Font(Size);
+		if(Font)
+		{
+			char Text[2] = { Character, 0 };
+			ILI9341_Draw_Text_Font(Font, Text, X, Y, Colour, Background_Colour);
+			return;
 		}
-   	
-		char temp[CHAR_WIDTH];
-		for(uint8_t k = 0; k<CHAR_WIDTH; k++)
+
+		if(Size > GLYPH_MAX_SIZE)
 		{
-		temp[k] = font[function_char][k];
+			//CELL TOO WIDE FOR A ROW MASK, FALL BACK TO ONE SPAN PER RUN OF SET BITS
+			ILI9341_Draw_Rectangle(X, Y, CHAR_WIDTH*Size, CHAR_HEIGHT*Size, Background_Colour);
+			for (j=0; j<CHAR_WIDTH; j++) {
+				for (i=0; i<CHAR_HEIGHT; i++) {
+					if (font[function_char][j] & (1<<i)) {
+						uint8_t Run = 1;
+						while ((i+Run < CHAR_HEIGHT) && (font[function_char][j] & (1<<(i+Run)))) Run++;
+
+						ILI9341_Draw_Rectangle(X+(j*Size), Y+(i*Size), Size, Run*Size, Colour);
+						i += Run - 1;
+					}
+				}
+			}
+			return;
+		}
+
+		if(ILI9341_Queue_Active)
+		{
+			ILI9341_Queue_Text(0, &Character, 1, X, Y, Colour, Size, Background_Colour);
+			return;
+		}
+
+		//CLIP THE CELL AT THE SCREEN EDGES
+		uint16_t Width = CHAR_WIDTH*Size;
+		uint16_t Height = CHAR_HEIGHT*Size;
+		if(X+Width > LCD_WIDTH) Width = LCD_WIDTH-X;
+		if(Y+Height > LCD_HEIGHT) Height = LCD_HEIGHT-Y;
+
+		ILI9341_Set_Address(X, Y, X+Width-1, Y+Height-1);
+
+		uint16_t Row = 0;
+		while(Row < Height)
+		{
+			//FILL ONE BUFFER WHILE THE OTHER ONE IS SENT
+			uint16_t* Buffer = ILI9341_Get_Tx_Buffer();
+			uint16_t Rows = ILI9341_Render_Char_Rows(Character, Size, Colour, Background_Colour, Width, Height, Row, Buffer);
+
+			ILI9341_Send_Tx_Buffer(Buffer, Rows*Width, 1, 0);
+			Row += Rows;
 		}
-		
-    // Draw pixels
-		ILI9341_Draw_Rectangle(X, Y, CHAR_WIDTH*Size, CHAR_HEIGHT*Size, Background_Colour);
-    for (j=0; j<CHAR_WIDTH; j++) {
-        for (i=0; i<CHAR_HEIGHT; i++) {
-            if (temp[j] & (1<<i)) {			
-							if(Size == 1)
-							{
-              ILI9341_Draw_Pixel(X+j, Y+i, Colour);
-							}
-							else
-							{
-							ILI9341_Draw_Rectangle(X+(j*Size), Y+(i*Size), Size, Size, Colour);
-							}
-            }						
-        }
-    }
 }
 
 /*Draws an array of characters (fonts imported from fonts.h) at X,Y location with specified font colour, size and Background colour*/
 /*See fonts.h implementation of font on what is required for changing to a different font when switching fonts libraries*/
-void ILI9341_Draw_Text(const char* Text, uint8_t X, uint8_t Y, uint16_t Colour, uint16_t Size, uint16_t Background_Colour)
+/*Sizes with an atlas send the whole string through one address window*/
+void ILI9341_Draw_Text(const char* Text, uint16_t X, uint16_t Y, uint16_t Colour, uint16_t Size, uint16_t Background_Colour)
 {
+	const ILI9341_Font* Font = ILI9341_Get_Font(Size);
+
+	if(Font)
+	{
+		ILI9341_Draw_Text_Font(Font, Text, X, Y, Colour, Background_Colour);
+		return;
+	}
+
+	if(ILI9341_Queue_Active && (Size != 0) && (Size <= GLYPH_MAX_SIZE))
+	{
+		//THE WHOLE STRING AS GLYPH RUNS, THE INTERRUPT RENDERS THEM
+		ILI9341_Queue_Text(0, Text, strlen(Text), X, Y, Colour, Size, Background_Colour);
+		return;
+	}
+
     while (*Text) {
         ILI9341_Draw_Char(*Text++, X, Y, Colour, Size, Background_Colour);
         X += CHAR_WIDTH*Size;
     }
 }
 
+/*Returns the horizontal advance of a character drawn with ILI9341_Draw_Char at the given size*/
+uint16_t ILI9341_Get_Char_Width(char Character, uint16_t Size)
+{
+	(void)Character;
+	return CHAR_WIDTH*Size;
+}
+
+/*Returns the height of a character cell drawn with ILI9341_Draw_Char at the given size*/
+uint16_t ILI9341_Get_Char_Height(uint16_t Size)
+{
+	return CHAR_HEIGHT*Size;
+}
+
 /*Draws a full screen picture from flash. Image converted from RGB .jpeg/other to C array using online converter*/
+/*The DMA reads the array straight out of flash, nothing is copied*/
 //USING CONVERTER: http://www.digole.com/tools/PicturetoC_Hex_converter.php
 //65K colour (2Bytes / Pixel)
 void ILI9341_Draw_Image(const char* Image_Array, uint8_t Orientation)
 {
-	if(Orientation == SCREEN_HORIZONTAL_1)
-	{
-		ILI9341_Set_Rotation(SCREEN_HORIZONTAL_1);
-		ILI9341_Set_Address(0,0,ILI9341_SCREEN_WIDTH,ILI9341_SCREEN_HEIGHT);
-			
-		HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
-		HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-		
-		unsigned char Temp_small_buffer[BURST_MAX_SIZE];
-		uint32_t counter = 0;
-		for(uint32_t i = 0; i < ILI9341_SCREEN_WIDTH*ILI9341_SCREEN_HEIGHT*2/BURST_MAX_SIZE; i++)
-		{			
-				for(uint32_t k = 0; k< BURST_MAX_SIZE; k++)
-				{
-					Temp_small_buffer[k]	= Image_Array[counter+k];		
-				}						
-				HAL_SPI_Transmit(HSPI_INSTANCE, (unsigned char*)Temp_small_buffer, BURST_MAX_SIZE, 10);
-				counter += BURST_MAX_SIZE;			
-		}
-		HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
-	}
-	else if(Orientation == SCREEN_HORIZONTAL_2)
-	{
-		ILI9341_Set_Rotation(SCREEN_HORIZONTAL_2);
-		ILI9341_Set_Address(0,0,ILI9341_SCREEN_WIDTH,ILI9341_SCREEN_HEIGHT);
-			
-		HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
-		HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-		
-		unsigned char Temp_small_buffer[BURST_MAX_SIZE];
-		uint32_t counter = 0;
-		for(uint32_t i = 0; i < ILI9341_SCREEN_WIDTH*ILI9341_SCREEN_HEIGHT*2/BURST_MAX_SIZE; i++)
-		{			
-				for(uint32_t k = 0; k< BURST_MAX_SIZE; k++)
-				{
-					Temp_small_buffer[k]	= Image_Array[counter+k];		
-				}						
-				HAL_SPI_Transmit(&hspi5, (unsigned char*)Temp_small_buffer, BURST_MAX_SIZE, 10);	
-				counter += BURST_MAX_SIZE;			
-		}
-		HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
-	}
-	else if(Orientation == SCREEN_VERTICAL_2)
-	{
-		ILI9341_Set_Rotation(SCREEN_VERTICAL_2);
-		ILI9341_Set_Address(0,0,ILI9341_SCREEN_HEIGHT,ILI9341_SCREEN_WIDTH);
-			
-		HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
-		HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-		
-		unsigned char Temp_small_buffer[BURST_MAX_SIZE];
-		uint32_t counter = 0;
-		for(uint32_t i = 0; i < ILI9341_SCREEN_WIDTH*ILI9341_SCREEN_HEIGHT*2/BURST_MAX_SIZE; i++)
-		{			
-				for(uint32_t k = 0; k< BURST_MAX_SIZE; k++)
-				{
-					Temp_small_buffer[k]	= Image_Array[counter+k];		
-				}						
-				HAL_SPI_Transmit(&hspi5, (unsigned char*)Temp_small_buffer, BURST_MAX_SIZE, 10);	
-				counter += BURST_MAX_SIZE;			
-		}
-		HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
-	}
-	else if(Orientation == SCREEN_VERTICAL_1)
-	{
-		ILI9341_Set_Rotation(SCREEN_VERTICAL_1);
-		ILI9341_Set_Address(0,0,ILI9341_SCREEN_HEIGHT,ILI9341_SCREEN_WIDTH);
-			
-		HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
-		HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-		
-		unsigned char Temp_small_buffer[BURST_MAX_SIZE];
-		uint32_t counter = 0;
-		for(uint32_t i = 0; i < ILI9341_SCREEN_WIDTH*ILI9341_SCREEN_HEIGHT*2/BURST_MAX_SIZE; i++)
-		{			
-				for(uint32_t k = 0; k< BURST_MAX_SIZE; k++)
-				{
-					Temp_small_buffer[k]	= Image_Array[counter+k];		
-				}						
-				HAL_SPI_Transmit(&hspi5, (unsigned char*)Temp_small_buffer, BURST_MAX_SIZE, 10);	
-				counter += BURST_MAX_SIZE;			
-		}
-		HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
-	}
+	if(Orientation > SCREEN_HORIZONTAL_2) return;
+
+#if ILI9341_ROTATION_RUNTIME
+	ILI9341_Set_Rotation(Orientation);
+	ILI9341_Set_Address(0,0,LCD_WIDTH-1,LCD_HEIGHT-1);
+	ILI9341_Send_Const((const unsigned char*)Image_Array, ILI9341_SCREEN_WIDTH*ILI9341_SCREEN_HEIGHT*2);
+#else
+	//THE PICTURE IS WRITTEN IN ITS OWN ORIENTATION, THE SCREEN RETURNS TO THE BUILD ORIENTATION ONCE IT IS SENT
+	ILI9341_Write_Rotation(Orientation);
+	if(Orientation & 1) ILI9341_Set_Address(0,0,ILI9341_SCREEN_WIDTH-1,ILI9341_SCREEN_HEIGHT-1);
+	else ILI9341_Set_Address(0,0,ILI9341_SCREEN_HEIGHT-1,ILI9341_SCREEN_WIDTH-1);
+	ILI9341_Send_Const((const unsigned char*)Image_Array, ILI9341_SCREEN_WIDTH*ILI9341_SCREEN_HEIGHT*2);
+	ILI9341_Write_Rotation(ILI9341_ROTATION);
+#endif
 }
 
 
@@ -0,0 +1,125 @@
+//-----------------------------------
+//	ILI9341 images from flash
+//-----------------------------------
+//
+//	See ILI9341_Image.h for the formats.
+//
+//-----------------------------------
+
+#include <lcd/ILI9341_Image.h>
+#include <lcd/ILI9341_STM32_Driver.h>
+#include <lcd/ILI9341_Queue.h>
+
+//RUNS OF AT LEAST THIS MANY PIXELS ARE SENT AS DMA FILL INSTEAD OF BEING COPIED INTO THE BUFFER
+#define IMAGE_FILL_RUN		32
+
+/* Reads one pixel of a compressed image and advances Data past it */
+static uint16_t ILI9341_Image_Pixel(const ILI9341_Image* Image, const uint8_t** Data)
+{
+	const uint8_t* Pixel = *Data;
+
+	if(Image->Format == ILI9341_IMAGE_RLE_PALETTE)
+	{
+		*Data += 1;
+		return Image->Palette[Pixel[0]];
+	}
+	*Data += 2;
+	return (uint16_t)(Pixel[0]<<8 | Pixel[1]);
+}
+
+/* Prepares Decoder for the pixels of a compressed image */
+void ILI9341_Image_Decoder_Init(ILI9341_Image_Decoder* Decoder, const ILI9341_Image* Image)
+{
+	Decoder->Image = Image;
+	Decoder->Data = Image->Data;
+	Decoder->Count = 0;
+	Decoder->Run = 0;
+	Decoder->Fill = 0;
+}
+
+/* Decodes the next piece of the image, returns its number of pixels or 0 at the end of the image */
+/* Either up to BURST_MAX_PIXELS pixels are written into Buffer, or Fill is set and the piece is Count pixels of Colour */
+uint16_t ILI9341_Image_Decode(ILI9341_Image_Decoder* Decoder, uint16_t* Buffer)
+{
+	const uint8_t* End = Decoder->Image->Data + Decoder->Image->Size;
+	uint16_t Filled = 0;
+
+	Decoder->Fill = 0;
+	while(Filled < BURST_MAX_PIXELS)
+	{
+		if(Decoder->Count == 0)
+		{
+			if(Decoder->Data >= End) break;
+
+			uint8_t Control = *Decoder->Data++;
+			Decoder->Count = (Control & ILI9341_IMAGE_COUNT_MASK) + 1;
+			if((Control & ILI9341_IMAGE_COUNT_MASK) == ILI9341_IMAGE_LONG_COUNT)
+			{
+				Decoder->Count = (uint16_t)(Decoder->Data[0]<<8 | Decoder->Data[1]);
+				Decoder->Data += 2;
+			}
+			Decoder->Run = (Control & ILI9341_IMAGE_RUN) != 0;
+			if(Decoder->Run) Decoder->Colour = ILI9341_Image_Pixel(Decoder->Image, &Decoder->Data);
+		}
+
+		if(Decoder->Run && (Decoder->Count >= IMAGE_FILL_RUN))
+		{
+			//PIXELS BEFORE THE RUN HAVE TO GO OUT FIRST, THE RUN FOLLOWS AS ONE FILL
+			if(Filled) break;
+
+			uint16_t Count = Decoder->Count;
+			Decoder->Count = 0;
+			Decoder->Fill = 1;
+			return Count;
+		}
+
+		while(Decoder->Count && (Filled < BURST_MAX_PIXELS))
+		{
+			Buffer[Filled++] = Decoder->Run ? Decoder->Colour : ILI9341_Image_Pixel(Decoder->Image, &Decoder->Data);
+			Decoder->Count--;
+		}
+	}
+	return Filled;
+}
+
+//DRAW AN IMAGE FROM FLASH WITH ITS UPPER LEFT CORNER AT X,Y
+//
+//Raw images are sent by DMA straight out of flash, compressed images are decoded block by block.
+//The image has to lie completely on the screen
+//
+void ILI9341_Draw_Bitmap(const ILI9341_Image* Image, uint16_t X, uint16_t Y)
+{
+	if((Image->Width == 0) || (Image->Height == 0)) return;
+	if((X+Image->Width-1 >=LCD_WIDTH) || (Y+Image->Height-1 >=LCD_HEIGHT)) return;
+
+	if(ILI9341_Queue_Active)
+	{
+		ILI9341_Queue_Image(Image, X, Y);
+		return;
+	}
+
+	ILI9341_Set_Address(X, Y, X+Image->Width-1, Y+Image->Height-1);
+
+	if(Image->Format == ILI9341_IMAGE_RAW)
+	{
+		ILI9341_Send_Const_Pixels((const uint16_t*)Image->Data, Image->Size/2);
+		return;
+	}
+
+	ILI9341_Image_Decoder Decoder;
+	uint16_t* Buffer = ILI9341_Get_Tx_Buffer();
+	uint16_t Count;
+
+	//ONE TRANSMIT BUFFER IS FILLED WHILE THE OTHER ONE IS ON THE WIRE
+	ILI9341_Image_Decoder_Init(&Decoder, Image);
+	while((Count = ILI9341_Image_Decode(&Decoder, Buffer)) != 0)
+	{
+		if(Decoder.Fill)
+		{
+			ILI9341_Draw_Colour_Burst(Decoder.Colour, Count);
+			continue;
+		}
+		ILI9341_Send_Tx_Buffer(Buffer, Count, 1, 0);
+		Buffer = ILI9341_Get_Tx_Buffer();
+	}
+}
@@ -0,0 +1,64 @@
+//-----------------------------------
+//	ILI9341 images from flash
+//-----------------------------------
+//
+//	An ILI9341_Image describes a picture of any size stored as a const array. tools/lcd_image converts a
+//	PPM file into a .c file holding one ILI9341_Image, the converter picks the smallest of three formats:
+//
+//	ILI9341_IMAGE_RAW			RGB565 as native uint16_t. The DMA streams it straight out of flash.
+//	ILI9341_IMAGE_RLE			Runs and literals of RGB565 pixels (high byte first).
+//	ILI9341_IMAGE_RLE_PALETTE	Runs and literals of 8 bit indices into Palette (up to 256 colours).
+//
+//	The compressed data is a sequence of packets, each starting with a control byte:
+//		bit 7		1 = run, one pixel follows that is repeated Count times
+//					0 = literal, Count pixels follow
+//		bit 6..0	Count-1 for counts of 1..127
+//					0x7F: Count follows as 16 bit value, high byte first
+//	Packets run on across rows, the pixels fill the image row by row.
+//
+//	Compressed images are decoded into the two DMA transmit buffers, one is filled while the other is sent.
+//	Long runs are sent as DMA fills and cost no decoding time at all.
+//
+//-----------------------------------
+
+#ifndef ILI9341_IMAGE_H
+#define ILI9341_IMAGE_H
+
+#include "stm32f4xx_hal.h"
+
+#define ILI9341_IMAGE_RAW				0
+#define ILI9341_IMAGE_RLE				1
+#define ILI9341_IMAGE_RLE_PALETTE		2
+
+//CONTROL BYTE OF A PACKET
+#define ILI9341_IMAGE_RUN				0x80
+#define ILI9341_IMAGE_COUNT_MASK		0x7F
+#define ILI9341_IMAGE_LONG_COUNT		0x7F
+
+typedef struct
+{
+	uint16_t Width;
+	uint16_t Height;
+	uint8_t Format;
+	uint16_t Colours;			//NUMBER OF PALETTE ENTRIES
+	const uint16_t* Palette;	//RGB565, ONLY USED BY ILI9341_IMAGE_RLE_PALETTE
+	const uint8_t* Data;
+	uint32_t Size;				//BYTES IN Data
+} ILI9341_Image;
+
+//POSITION IN A COMPRESSED IMAGE, LETS THE DISPLAY LIST DECODE IT ONE BLOCK PER DMA INTERRUPT
+typedef struct
+{
+	const ILI9341_Image* Image;
+	const uint8_t* Data;
+	uint16_t Count;				//PIXELS LEFT IN THE CURRENT PACKET
+	uint8_t Run;				//CURRENT PACKET IS A RUN OF Colour
+	uint8_t Fill;				//LAST PIECE WAS A RUN TO BE SENT AS DMA FILL
+	uint16_t Colour;
+} ILI9341_Image_Decoder;
+
+void ILI9341_Draw_Bitmap(const ILI9341_Image* Image, uint16_t X, uint16_t Y);
+void ILI9341_Image_Decoder_Init(ILI9341_Image_Decoder* Decoder, const ILI9341_Image* Image);
+uint16_t ILI9341_Image_Decode(ILI9341_Image_Decoder* Decoder, uint16_t* Buffer);
+
+#endif
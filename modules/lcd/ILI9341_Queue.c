@@ -0,0 +1,361 @@
+//-----------------------------------
+//	ILI9341 display list
+//-----------------------------------
+//
+//	See ILI9341_Queue.h. Queue_Head is only written by the producer, Queue_Tail only by the consumer
+//	(and by ILI9341_QUEUE_DROP_OLDEST with the interrupt masked). Both run freely and wrap at 65536,
+//	which ILI9341_QUEUE_DEPTH divides.
+//
+//	The consumer copies a command out of the ring before it starts it, so every entry between
+//	Queue_Tail and Queue_Head is waiting and may still be merged or dropped.
+//
+//-----------------------------------
+
+#include <lcd/ILI9341_Queue.h>
+#include <lcd/ILI9341_STM32_Driver.h>
+#include <lcd/ILI9341_GFX.h>
+#include <lcd/ILI9341_Shadow.h>
+#include <lcd/ILI9341_Region.h>
+#include <string.h>
+
+#define QUEUE_FILL		0
+#define QUEUE_TEXT		1
+#define QUEUE_IMAGE		2
+
+typedef struct
+{
+	uint8_t Type;
+	uint8_t Size;				//TEXT SIZE
+	uint8_t Length;				//CHARACTERS IN Text
+	uint16_t X;
+	uint16_t Y;
+	uint16_t Width;				//CLIPPED AREA THE COMMAND COVERS
+	uint16_t Height;
+	uint16_t Colour;
+	uint16_t Background_Colour;
+	const ILI9341_Image* Image;
+	const ILI9341_Font* Font;	//0 FOR A GLYPH RUN AT Size
+	char Text[ILI9341_QUEUE_TEXT];
+} ILI9341_Queue_Command;
+
+uint8_t ILI9341_Queue_Active = 0;
+
+static uint8_t Queue_Policy = ILI9341_QUEUE_BLOCK;
+static ILI9341_Queue_Command Queue[ILI9341_QUEUE_DEPTH];
+static volatile uint16_t Queue_Head = 0;
+static volatile uint16_t Queue_Tail = 0;
+static ILI9341_Queue_Stats Queue_Stats;
+
+//COMMAND THE INTERRUPT IS WORKING ON
+static ILI9341_Queue_Command Current;
+static uint8_t Current_Valid = 0;
+static uint8_t Current_Started;
+static uint8_t Current_Char;
+static uint16_t Current_Row;
+static ILI9341_Image_Decoder Current_Decoder;
+static ILI9341_Text_Run Current_Run;
+
+static uint16_t ILI9341_Queue_Depth(void)
+{
+	return (uint16_t)(Queue_Head - Queue_Tail);
+}
+
+/*Drawing calls are stored from now on, Policy says what happens when the queue is full*/
+void ILI9341_Queue_Begin(uint8_t Policy)
+{
+	if(ILI9341_Shadow_Active || ILI9341_Region_Active) return;
+
+	Queue_Policy = Policy;
+	ILI9341_Queue_Active = 1;
+}
+
+/*Waits until every queued command has been sent, drawing calls go straight to the panel again*/
+void ILI9341_Queue_End(void)
+{
+	ILI9341_Wait_Idle();
+	ILI9341_Queue_Active = 0;
+}
+
+/*Policy given to the last ILI9341_Queue_Begin()*/
+uint8_t ILI9341_Queue_Get_Policy(void)
+{
+	return Queue_Policy;
+}
+
+/*Returns 1 while commands are waiting*/
+uint8_t ILI9341_Queue_Pending(void)
+{
+	return Queue_Head != Queue_Tail;
+}
+
+void ILI9341_Queue_Get_Stats(ILI9341_Queue_Stats* Stats)
+{
+	*Stats = Queue_Stats;
+	Stats->Depth = ILI9341_Queue_Depth();
+}
+
+void ILI9341_Queue_Reset_Stats(void)
+{
+	memset(&Queue_Stats, 0, sizeof(Queue_Stats));
+}
+
+/*Returns the entry at Queue_Head, makes room first if the queue is full*/
+static ILI9341_Queue_Command* ILI9341_Queue_Slot(void)
+{
+	if(ILI9341_Queue_Depth() >= ILI9341_QUEUE_DEPTH)
+	{
+		if(Queue_Policy == ILI9341_QUEUE_DROP_OLDEST)
+		{
+			HAL_NVIC_DisableIRQ(LCD_DMA_IRQn);
+			if(ILI9341_Queue_Depth() >= ILI9341_QUEUE_DEPTH)
+			{
+				Queue_Tail++;
+				Queue_Stats.Dropped++;
+			}
+			HAL_NVIC_EnableIRQ(LCD_DMA_IRQn);
+		}
+		else
+		{
+			Queue_Stats.Stalls++;
+			while(ILI9341_Queue_Depth() >= ILI9341_QUEUE_DEPTH) ILI9341_WAIT_HOOK();
+		}
+	}
+	return &Queue[Queue_Head % ILI9341_QUEUE_DEPTH];
+}
+
+/*Hands the entry at Queue_Head to the interrupt and starts the list if the SPI is idle*/
+static void ILI9341_Queue_Push(void)
+{
+	//THE ENTRY HAS TO BE COMPLETE BEFORE THE INTERRUPT CAN SEE IT
+	__DMB();
+	Queue_Head++;
+
+	Queue_Stats.Commands++;
+	uint16_t Depth = ILI9341_Queue_Depth();
+	if(Depth > Queue_Stats.Max_Depth) Queue_Stats.Max_Depth = Depth;
+
+	ILI9341_Start_Queue();
+}
+
+/*Returns 1 if the command covers part of the rectangle*/
+static uint8_t ILI9341_Queue_Overlaps(const ILI9341_Queue_Command* Command, uint16_t X, uint16_t Y, uint16_t Width, uint16_t Height)
+{
+	return (Command->X < X+Width) && (X < Command->X+Command->Width) &&
+		   (Command->Y < Y+Height) && (Y < Command->Y+Command->Height);
+}
+
+/*Gives a waiting fill of the same region the new colour, returns 1 if one was found*/
+/*Searches from the newest command back and stops at the first one that overlaps the region otherwise*/
+static uint8_t ILI9341_Queue_Coalesce(uint16_t X, uint16_t Y, uint16_t Width, uint16_t Height, uint16_t Colour)
+{
+	uint8_t Merged = 0;
+
+	//THE INTERRUPT MUST NOT TAKE THE ENTRY OUT WHILE IT IS CHANGED
+	HAL_NVIC_DisableIRQ(LCD_DMA_IRQn);
+	for(uint16_t i = Queue_Head; i != Queue_Tail; )
+	{
+		ILI9341_Queue_Command* Command = &Queue[--i % ILI9341_QUEUE_DEPTH];
+
+		if(!ILI9341_Queue_Overlaps(Command, X, Y, Width, Height)) continue;
+		if((Command->Type == QUEUE_FILL) && (Command->X == X) && (Command->Y == Y) &&
+		   (Command->Width == Width) && (Command->Height == Height))
+		{
+			Command->Colour = Colour;
+			Merged = 1;
+		}
+		break;
+	}
+	HAL_NVIC_EnableIRQ(LCD_DMA_IRQn);
+
+	if(Merged) Queue_Stats.Coalesced++;
+	return Merged;
+}
+
+/*Queues a solid rectangle*/
+void ILI9341_Queue_Fill(uint16_t X, uint16_t Y, uint16_t Width, uint16_t Height, uint16_t Colour)
+{
+	if((Width == 0) || (Height == 0)) return;
+	if((Queue_Policy == ILI9341_QUEUE_COALESCE) && ILI9341_Queue_Coalesce(X, Y, Width, Height, Colour)) return;
+
+	ILI9341_Queue_Command* Command = ILI9341_Queue_Slot();
+	Command->Type = QUEUE_FILL;
+	Command->X = X;
+	Command->Y = Y;
+	Command->Width = Width;
+	Command->Height = Height;
+	Command->Colour = Colour;
+	ILI9341_Queue_Push();
+}
+
+/*Queues Length characters as runs of up to ILI9341_QUEUE_TEXT characters*/
+void ILI9341_Queue_Text(const ILI9341_Font* Font, const char* Text, uint16_t Length, uint16_t X, uint16_t Y, uint16_t Colour, uint16_t Size, uint16_t Background_Colour)
+{
+	uint16_t Height = Font ? Font->Height : ILI9341_Get_Char_Height(Size);
+
+	if(Y >= LCD_HEIGHT) return;
+	if(Y+Height > LCD_HEIGHT) Height = LCD_HEIGHT-Y;
+
+	while(Length && (X < LCD_WIDTH))
+	{
+		uint8_t Count = (Length > ILI9341_QUEUE_TEXT) ? ILI9341_QUEUE_TEXT : Length;
+		uint16_t Advance = Count*ILI9341_Get_Char_Width(' ', Size);
+		if(Font)
+		{
+			//THE KERNING TO THE FIRST CHARACTER OF THE NEXT RUN BELONGS TO THIS ONE
+			Advance = ILI9341_Get_Text_Width(Font, Text, Count);
+			if(Length > Count) Advance += ILI9341_Get_Kerning(Font, Text[Count-1], Text[Count]);
+		}
+		uint16_t Width = Advance;
+		if(X+Width > LCD_WIDTH) Width = LCD_WIDTH-X;
+
+		ILI9341_Queue_Command* Command = ILI9341_Queue_Slot();
+		Command->Type = QUEUE_TEXT;
+		Command->X = X;
+		Command->Y = Y;
+		Command->Width = Width;
+		Command->Height = Height;
+		Command->Colour = Colour;
+		Command->Background_Colour = Background_Colour;
+		Command->Font = Font;
+		Command->Size = Size;
+		Command->Length = Count;
+		memcpy(Command->Text, Text, Count);
+		ILI9341_Queue_Push();
+
+		X += Advance;
+		Text += Count;
+		Length -= Count;
+	}
+}
+
+/*Queues an image from flash, it has to lie completely on the screen*/
+void ILI9341_Queue_Image(const ILI9341_Image* Image, uint16_t X, uint16_t Y)
+{
+	ILI9341_Queue_Command* Command = ILI9341_Queue_Slot();
+	Command->Type = QUEUE_IMAGE;
+	Command->X = X;
+	Command->Y = Y;
+	Command->Width = Image->Width;
+	Command->Height = Image->Height;
+	Command->Image = Image;
+	ILI9341_Queue_Push();
+}
+
+/*Next block of a text run rendered with an atlas: one window for the whole run*/
+static uint8_t ILI9341_Queue_Font_Step(void)
+{
+	if(!Current_Started)
+	{
+		Current_Started = 1;
+		ILI9341_Direct_Window(Current.X, Current.Y, Current.X+Current.Width-1, Current.Y+Current.Height-1);
+		ILI9341_Text_Run_Init(&Current_Run, Current.Font, Current.Text, Current.Length, Current.Width, Current.Height,
+							  Current.Colour, Current.Background_Colour);
+	}
+
+	uint16_t* Buffer = ILI9341_Direct_Buffer();
+	uint16_t Count = ILI9341_Render_Text(&Current_Run, Buffer);
+
+	if(Count == 0) return 0;
+	ILI9341_Direct_Pixels(Buffer, Count);
+	return 1;
+}
+
+/*Next block of a glyph run: every character gets its own window, its rows are rendered one buffer at a time*/
+static uint8_t ILI9341_Queue_Text_Step(void)
+{
+	if(Current.Font) return ILI9341_Queue_Font_Step();
+
+	uint16_t Advance = ILI9341_Get_Char_Width(' ', Current.Size);
+
+	if(Current_Char >= Current.Length) return 0;
+
+	uint16_t X = Current.X + Current_Char*Advance;
+	uint16_t Width = Advance;
+	if(X >= LCD_WIDTH) return 0;
+	if(X+Width > LCD_WIDTH) Width = LCD_WIDTH-X;
+
+	if(Current_Row == 0) ILI9341_Direct_Window(X, Current.Y, X+Width-1, Current.Y+Current.Height-1);
+
+	uint16_t* Buffer = ILI9341_Direct_Buffer();
+	uint16_t Rows = ILI9341_Render_Char_Rows(Current.Text[Current_Char], Current.Size, Current.Colour,
+											 Current.Background_Colour, Width, Current.Height, Current_Row, Buffer);
+	Current_Row += Rows;
+	if(Current_Row >= Current.Height)
+	{
+		Current_Row = 0;
+		Current_Char++;
+	}
+	ILI9341_Direct_Pixels(Buffer, Rows*Width);
+	return 1;
+}
+
+/*Next block of an image: raw images go out in one transfer, compressed ones one decoded block or run at a time*/
+static uint8_t ILI9341_Queue_Image_Step(void)
+{
+	const ILI9341_Image* Image = Current.Image;
+
+	if(!Current_Started)
+	{
+		Current_Started = 1;
+		ILI9341_Direct_Window(Current.X, Current.Y, Current.X+Image->Width-1, Current.Y+Image->Height-1);
+		if(Image->Format == ILI9341_IMAGE_RAW)
+		{
+			ILI9341_Direct_Pixels((const uint16_t*)Image->Data, Image->Size/2);
+			return 1;
+		}
+		ILI9341_Image_Decoder_Init(&Current_Decoder, Image);
+	}
+	else if(Image->Format == ILI9341_IMAGE_RAW)
+	{
+		return 0;
+	}
+
+	uint16_t* Buffer = ILI9341_Direct_Buffer();
+	uint16_t Count = ILI9341_Image_Decode(&Current_Decoder, Buffer);
+
+	if(Count == 0) return 0;
+	if(Current_Decoder.Fill) ILI9341_Direct_Fill(Current_Decoder.Colour, Count);
+	else ILI9341_Direct_Pixels(Buffer, Count);
+	return 1;
+}
+
+/*Starts the next transfer of the current command, returns 0 when the command is done*/
+static uint8_t ILI9341_Queue_Step(void)
+{
+	switch(Current.Type)
+	{
+	case QUEUE_FILL:
+		if(Current_Started) return 0;
+		Current_Started = 1;
+		ILI9341_Direct_Window(Current.X, Current.Y, Current.X+Current.Width-1, Current.Y+Current.Height-1);
+		ILI9341_Direct_Fill(Current.Colour, (uint32_t)Current.Width*Current.Height);
+		return 1;
+	case QUEUE_TEXT:
+		return ILI9341_Queue_Text_Step();
+	case QUEUE_IMAGE:
+		return ILI9341_Queue_Image_Step();
+	default:
+		return 0;
+	}
+}
+
+/*Runs in the DMA interrupt after the last transfer has finished: starts the next transfer of the list*/
+uint8_t ILI9341_Queue_Next(void)
+{
+	while(1)
+	{
+		if(!Current_Valid)
+		{
+			if(Queue_Tail == Queue_Head) return 0;
+
+			Current = Queue[Queue_Tail % ILI9341_QUEUE_DEPTH];
+			Queue_Tail++;
+			Current_Valid = 1;
+			Current_Started = 0;
+			Current_Char = 0;
+			Current_Row = 0;
+		}
+		if(ILI9341_Queue_Step()) return 1;
+		Current_Valid = 0;
+	}
+}
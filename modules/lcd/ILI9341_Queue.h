@@ -0,0 +1,78 @@
+//-----------------------------------
+//	ILI9341 display list
+//-----------------------------------
+//
+//	While the display list is active the drawing calls of ILI9341_STM32_Driver, ILI9341_GFX and ILI9341_Image
+//	do not wait for the SPI. They store a compact command (fill, glyph run or image) in a ring of
+//	ILI9341_QUEUE_DEPTH entries and return. The DMA interrupt executes the commands one after the other:
+//	when a transfer has finished it sets up the next address window and starts the next fill, the next
+//	rendered block of text rows or the next decoded block of an image. The main loop only pays for the copy
+//	of the command, and for starting the first one when the SPI was idle.
+//
+//	The ring has one producer (the main loop) and one consumer (the DMA interrupt). Adding a command needs
+//	no lock; only the DROP_OLDEST and COALESCE policies mask the DMA interrupt while they change queued entries.
+//	When the ring is full the policy decides:
+//
+//	ILI9341_QUEUE_BLOCK			The call waits until the interrupt has taken a command out.
+//	ILI9341_QUEUE_DROP_OLDEST	The oldest command that has not been started is thrown away.
+//	ILI9341_QUEUE_COALESCE		A fill of exactly the region of a queued fill replaces its colour instead of
+//								taking a slot, as long as no command queued after it overlaps the region.
+//								This is tried for every fill. When the ring is still full the call waits.
+//
+//	Calls that cannot be stored (pixel arrays from RAM, single colour writes, rotation, scrolling, plain
+//	commands) wait until the list has run empty and then execute directly, so the order of the drawing is kept.
+//	ILI9341_Wait_Idle() and ILI9341_Is_Busy() include the queued commands.
+//
+//	Not meant to be used together with the RAM shadow, ILI9341_Queue_Begin() does nothing while it is active.
+//
+//-----------------------------------
+
+#ifndef ILI9341_QUEUE_H
+#define ILI9341_QUEUE_H
+
+#include "stm32f4xx_hal.h"
+#include <lcd/ILI9341_Image.h>
+#include <lcd/ILI9341_Font.h>
+
+//NUMBER OF COMMANDS, A POWER OF TWO
+#ifndef ILI9341_QUEUE_DEPTH
+#define ILI9341_QUEUE_DEPTH			32
+#endif
+
+//CHARACTERS PER GLYPH RUN, LONGER TEXTS TAKE SEVERAL COMMANDS
+#define ILI9341_QUEUE_TEXT			8
+
+//POLICIES FOR A FULL QUEUE
+#define ILI9341_QUEUE_BLOCK			0
+#define ILI9341_QUEUE_DROP_OLDEST	1
+#define ILI9341_QUEUE_COALESCE		2
+
+typedef struct
+{
+	uint16_t Depth;			//COMMANDS WAITING RIGHT NOW
+	uint16_t Max_Depth;		//MOST COMMANDS WAITING AT ONCE
+	uint32_t Commands;		//COMMANDS TAKEN INTO THE QUEUE
+	uint32_t Stalls;		//CALLS THAT HAD TO WAIT FOR A FREE ENTRY
+	uint32_t Dropped;		//COMMANDS THROWN AWAY BY ILI9341_QUEUE_DROP_OLDEST
+	uint32_t Coalesced;		//FILLS MERGED INTO A QUEUED FILL BY ILI9341_QUEUE_COALESCE
+} ILI9341_Queue_Stats;
+
+extern uint8_t ILI9341_Queue_Active;
+
+void ILI9341_Queue_Begin(uint8_t Policy);
+void ILI9341_Queue_End(void);
+uint8_t ILI9341_Queue_Get_Policy(void);
+uint8_t ILI9341_Queue_Pending(void);
+void ILI9341_Queue_Get_Stats(ILI9341_Queue_Stats* Stats);
+void ILI9341_Queue_Reset_Stats(void);
+
+//CALLED BY THE DRAWING FUNCTIONS WHILE THE QUEUE IS ACTIVE, THE ARGUMENTS ARE ALREADY CLIPPED
+//TEXT IS RENDERED WITH Font, OR GLYPH BY GLYPH AT Size WHEN Font IS 0
+void ILI9341_Queue_Fill(uint16_t X, uint16_t Y, uint16_t Width, uint16_t Height, uint16_t Colour);
+void ILI9341_Queue_Text(const ILI9341_Font* Font, const char* Text, uint16_t Length, uint16_t X, uint16_t Y, uint16_t Colour, uint16_t Size, uint16_t Background_Colour);
+void ILI9341_Queue_Image(const ILI9341_Image* Image, uint16_t X, uint16_t Y);
+
+//CALLED BY THE DRIVER WHEN THE SPI HAS NOTHING LEFT TO SEND, RETURNS 1 IF A TRANSFER WAS STARTED
+uint8_t ILI9341_Queue_Next(void);
+
+#endif
@@ -0,0 +1,185 @@
+//-----------------------------------
+//	ILI9341 region buffers
+//-----------------------------------
+//
+//	See ILI9341_Region.h. The address window and its write position behave like those of the panel,
+//	pixels are stored where window and region overlap.
+//
+//-----------------------------------
+
+#include <lcd/ILI9341_Region.h>
+#include <lcd/ILI9341_STM32_Driver.h>
+#include <lcd/ILI9341_Queue.h>
+#include <string.h>
+
+uint8_t ILI9341_Region_Active = 0;
+
+static ILI9341_Region* Active_Region;
+
+//ADDRESS WINDOW AND WRITE POSITION, SAME AUTO INCREMENT AS THE PANEL
+static uint16_t Win_X1, Win_Y1, Win_X2, Win_Y2;
+static uint16_t Cursor_X, Cursor_Y;
+
+//HIGH BYTE OF A PIXEL THAT WAS SPLIT BETWEEN TWO WRITES
+static uint8_t Pending_Byte;
+static uint8_t Pending_Valid = 0;
+
+//DISPLAY LIST SECTION THE REGION PAUSED, RESUMED BY ILI9341_Region_End
+static uint8_t Queue_Paused = 0;
+static uint8_t Queue_Paused_Policy;
+
+/*Sets up a region of Width x Height pixels at X,Y, Pixels must hold Width*Height colours*/
+/*The part outside of the screen is cut off*/
+void ILI9341_Region_Init(ILI9341_Region* Region, uint16_t* Pixels, uint16_t X, uint16_t Y, uint16_t Width, uint16_t Height)
+{
+	if(X >= LCD_WIDTH) Width = 0;
+	else if(X+Width > LCD_WIDTH) Width = LCD_WIDTH-X;
+	if(Y >= LCD_HEIGHT) Height = 0;
+	else if(Y+Height > LCD_HEIGHT) Height = LCD_HEIGHT-Y;
+
+	Region->X = X;
+	Region->Y = Y;
+	Region->Width = Width;
+	Region->Height = Height;
+	Region->Pixels = Pixels;
+}
+
+/*Redirects all following drawing calls into the region*/
+void ILI9341_Region_Begin(ILI9341_Region* Target)
+{
+	//QUEUED COMMANDS WOULD BYPASS THE REGION, THE WAIT ALSO COVERS THE TRANSFER OF THE LAST REGION
+	Queue_Paused = ILI9341_Queue_Active;
+	Queue_Paused_Policy = ILI9341_Queue_Get_Policy();
+	ILI9341_Queue_End();
+
+	Active_Region = Target;
+	ILI9341_Region_Window(Target->X, Target->Y, Target->X+Target->Width-1, Target->Y+Target->Height-1);
+	ILI9341_Region_Active = 1;
+}
+
+/*Sends the region through one address window, drawing calls go where they went before ILI9341_Region_Begin again*/
+void ILI9341_Region_End(void)
+{
+	if(!ILI9341_Region_Active) return;
+
+	ILI9341_Region_Active = 0;
+	if((Active_Region->Width != 0) && (Active_Region->Height != 0))
+	{
+		ILI9341_Set_Address(Active_Region->X, Active_Region->Y, Active_Region->X+Active_Region->Width-1, Active_Region->Y+Active_Region->Height-1);
+		ILI9341_Send_Const_Pixels(Active_Region->Pixels, (uint32_t)Active_Region->Width*Active_Region->Height);
+	}
+
+	//THE LIST STARTS ITS NEXT COMMAND WHEN THE REGION IS ON THE PANEL
+	if(Queue_Paused)
+	{
+		Queue_Paused = 0;
+		ILI9341_Queue_Begin(Queue_Paused_Policy);
+	}
+}
+
+/*Moves the write position on by Count pixels within the current row of the window*/
+static void ILI9341_Region_Advance(uint16_t Count)
+{
+	Cursor_X += Count;
+	if(Cursor_X > Win_X2)
+	{
+		Cursor_X = Win_X1;
+		if(++Cursor_Y > Win_Y2) Cursor_Y = Win_Y1;
+	}
+}
+
+/*Stores Count pixels from the write position on, Count must not leave the current row*/
+/*Without Colours the pixels all get Colour, otherwise the next Count entries of Colours*/
+static void ILI9341_Region_Put(const uint16_t* Colours, uint16_t Colour, uint16_t Count)
+{
+	uint16_t Start = Cursor_X;
+	uint16_t End = Cursor_X+Count;
+	uint16_t Y = Cursor_Y;
+	uint16_t Skip = 0;
+
+	ILI9341_Region_Advance(Count);
+
+	//ONLY THE PART INSIDE THE REGION IS KEPT
+	if((Y < Active_Region->Y) || (Y >= Active_Region->Y+Active_Region->Height)) return;
+	if(Start < Active_Region->X)
+	{
+		Skip = Active_Region->X-Start;
+		Start = Active_Region->X;
+	}
+	if(End > Active_Region->X+Active_Region->Width) End = Active_Region->X+Active_Region->Width;
+	if(Start >= End) return;
+
+	uint16_t* Pixel = &Active_Region->Pixels[(Y-Active_Region->Y)*Active_Region->Width + Start-Active_Region->X];
+	uint16_t Length = End-Start;
+	if(Colours)
+	{
+		memcpy(Pixel, Colours+Skip, Length*sizeof(uint16_t));
+		return;
+	}
+	while(Length--) *Pixel++ = Colour;
+}
+
+void ILI9341_Region_Window(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2)
+{
+	Win_X1 = X1;
+	Win_Y1 = Y1;
+	Win_X2 = X2;
+	Win_Y2 = Y2;
+	Cursor_X = X1;
+	Cursor_Y = Y1;
+	Pending_Valid = 0;
+}
+
+void ILI9341_Region_Fill(uint16_t Colour, uint32_t Size)
+{
+	while(Size)
+	{
+		uint32_t Run = Win_X2 - Cursor_X + 1;
+		if(Run > Size) Run = Size;
+
+		ILI9341_Region_Put(0, Colour, Run);
+		Size -= Run;
+	}
+}
+
+void ILI9341_Region_Write(const unsigned char* Buffer, uint16_t Size, uint32_t Repeat, uint16_t Remainder)
+{
+	//SAME BYTE SEQUENCE THE DMA JOB WOULD HAVE SENT, HIGH BYTE FIRST
+	for(uint32_t r = 0; r <= Repeat; r++)
+	{
+		uint16_t Count = (r < Repeat) ? Size : Remainder;
+		for(uint16_t i = 0; i < Count; i++)
+		{
+			if(!Pending_Valid)
+			{
+				Pending_Byte = Buffer[i];
+				Pending_Valid = 1;
+			}
+			else
+			{
+				ILI9341_Region_Put(0, (Pending_Byte << 8) | Buffer[i], 1);
+				Pending_Valid = 0;
+			}
+		}
+	}
+}
+
+void ILI9341_Region_Write_Pixels(const uint16_t* Buffer, uint16_t Size, uint32_t Repeat, uint16_t Remainder)
+{
+	for(uint32_t r = 0; r <= Repeat; r++)
+	{
+		const uint16_t* Colours = Buffer;
+		uint16_t Count = (r < Repeat) ? Size : Remainder;
+
+		//ONE COPY PER ROW OF THE WINDOW THE PIXELS SPAN
+		while(Count)
+		{
+			uint16_t Run = Win_X2 - Cursor_X + 1;
+			if(Run > Count) Run = Count;
+
+			ILI9341_Region_Put(Colours, 0, Run);
+			Colours += Run;
+			Count -= Run;
+		}
+	}
+}
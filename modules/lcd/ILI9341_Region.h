@@ -0,0 +1,51 @@
+//-----------------------------------
+//	ILI9341 region buffers
+//-----------------------------------
+//
+//	A region is a small off-screen copy of one rectangle of the screen, in a pixel array the caller provides.
+//	Between ILI9341_Region_Begin() and ILI9341_Region_End() the drawing calls of ILI9341_STM32_Driver,
+//	ILI9341_GFX, ILI9341_Font, ILI9341_Image and ILI9341_Shapes write into the region instead of the panel;
+//	whatever falls outside of it is dropped. ILI9341_Region_End() then sends the finished rectangle through
+//	one address window in one DMA transfer.
+//
+//	The panel never shows a half drawn state: a text whose background is filled before its glyphs, a widget
+//	cleared before it is redrawn. Several calls that each open their own window (the changed characters of
+//	a text field, a button and its label) cost a single window.
+//
+//	The DMA reads the pixel array while ILI9341_Region_End() has long returned, the next ILI9341_Region_Begin()
+//	waits for that transfer, so one array can be reused for every region. The region starts out with unknown
+//	content, draw its whole rectangle. With the RAM shadow active the finished region goes into the shadow.
+//
+//	Inside a display list section the list is paused: ILI9341_Region_Begin() waits until the queued commands
+//	have been sent, ILI9341_Region_End() sends the region and resumes the list with the same policy. The caller
+//	stays in display list mode, but the region costs the wait for the list.
+//
+//-----------------------------------
+
+#ifndef ILI9341_REGION_H
+#define ILI9341_REGION_H
+
+#include "stm32f4xx_hal.h"
+
+typedef struct
+{
+	uint16_t X;
+	uint16_t Y;
+	uint16_t Width;
+	uint16_t Height;
+	uint16_t* Pixels;			//WIDTH*HEIGHT COLOURS, ROW BY ROW
+} ILI9341_Region;
+
+extern uint8_t ILI9341_Region_Active;
+
+void ILI9341_Region_Init(ILI9341_Region* Region, uint16_t* Pixels, uint16_t X, uint16_t Y, uint16_t Width, uint16_t Height);
+void ILI9341_Region_Begin(ILI9341_Region* Region);
+void ILI9341_Region_End(void);
+
+//CALLED BY THE DRIVER WHILE A REGION IS ACTIVE
+void ILI9341_Region_Window(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2);
+void ILI9341_Region_Fill(uint16_t Colour, uint32_t Size);
+void ILI9341_Region_Write(const unsigned char* Buffer, uint16_t Size, uint32_t Repeat, uint16_t Remainder);
+void ILI9341_Region_Write_Pixels(const uint16_t* Buffer, uint16_t Size, uint32_t Repeat, uint16_t Remainder);
+
+#endif
@@ -0,0 +1,240 @@
+//-----------------------------------
+//	ILI9341 on SPI5
+//-----------------------------------
+//
+//	See ILI9341_SPI.h. Also holds ILI9341_Transport_SPI_Polling: every write is sent with HAL_SPI_Transmit
+//	before the call returns, so no buffer is ever read after a call and the display list runs to the end
+//	as soon as it is started.
+//
+//-----------------------------------
+
+#include <lcd/ILI9341_SPI.h>
+#include <lcd/ILI9341_STM32_Driver.h>
+#include <lcd/ILI9341_Transport.h>
+#include <lcd/ILI9341_Queue.h>
+
+SPI_HandleTypeDef hspi5;
+
+//COLOURS A POLLED FILL SENDS PER HAL_SPI_Transmit
+#define REPEAT_PIXELS		64
+
+static uint16_t Repeat_Buffer[REPEAT_PIXELS];
+
+/* Initialize GPIO */
+static
+void ILI9341_GPIO_Init(void)
+{
+	GPIO_InitTypeDef gpio;
+	__GPIOC_CLK_ENABLE();
+	__GPIOD_CLK_ENABLE();
+	__GPIOF_CLK_ENABLE();
+
+	gpio.Pin = LCD_CS_PIN;
+	gpio.Mode = GPIO_MODE_OUTPUT_PP;
+	gpio.Pull = GPIO_NOPULL;
+	gpio.Speed = GPIO_SPEED_MEDIUM;
+	HAL_GPIO_Init(LCD_CS_PORT, &gpio);
+
+	gpio.Pin = LCD_DC_PIN;
+	gpio.Mode = GPIO_MODE_OUTPUT_PP;
+	gpio.Pull = GPIO_NOPULL;
+	gpio.Speed = GPIO_SPEED_MEDIUM;
+	HAL_GPIO_Init(LCD_DC_PORT, &gpio);
+
+	gpio.Pin = GPIO_PIN_7 | GPIO_PIN_8 | GPIO_PIN_9;
+	gpio.Mode = GPIO_MODE_AF_PP;
+	gpio.Pull = GPIO_NOPULL;
+	gpio.Speed = GPIO_SPEED_MEDIUM;
+	gpio.Alternate = GPIO_AF5_SPI5;
+	HAL_GPIO_Init(GPIOF, &gpio);
+}
+
+/* Initialize SPI */
+void ILI9341_SPI_Init(void)
+{
+	__SPI5_CLK_ENABLE();
+
+	hspi5.Instance = SPI5;
+	hspi5.Init.Mode = SPI_MODE_MASTER;
+	hspi5.Init.Direction = SPI_DIRECTION_2LINES;
+	hspi5.Init.DataSize = SPI_DATASIZE_8BIT;
+	hspi5.Init.CLKPolarity = SPI_POLARITY_LOW;
+	hspi5.Init.CLKPhase = SPI_PHASE_1EDGE;
+	hspi5.Init.NSS = SPI_NSS_SOFT;
+	hspi5.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_2;
+	hspi5.Init.FirstBit = SPI_FIRSTBIT_MSB;
+	hspi5.Init.TIMode = SPI_TIMODE_DISABLE;
+	hspi5.Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE;
+	hspi5.Init.CRCPolynomial = 7;
+
+
+	HAL_SPI_Init(&hspi5);
+	ILI9341_GPIO_Init();
+
+	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);	//CS OFF
+}
+
+/*Send data (char) to LCD*/
+void ILI9341_SPI_Send(unsigned char SPI_Data)
+{
+	HAL_SPI_Transmit(HSPI_INSTANCE, &SPI_Data, 1, 1);
+}
+
+/* Switches SPI5 between 8 bit frames (commands, parameters, byte arrays) and 16 bit frames (pixels) */
+/* DFF may only change while the SPI is disabled, the caller makes sure no transfer is running */
+void ILI9341_SPI_Frame_Size(uint32_t Data_Size)
+{
+	if(hspi5.Init.DataSize == Data_Size) return;
+
+	__HAL_SPI_DISABLE(&hspi5);
+	hspi5.Init.DataSize = Data_Size;
+	hspi5.Instance->CR1 = (hspi5.Instance->CR1 & ~SPI_CR1_DFF) | Data_Size;
+	__HAL_SPI_ENABLE(&hspi5);
+}
+
+/* Ends the chip select */
+void ILI9341_SPI_Release(void)
+{
+	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
+}
+
+/* Sends a command and its parameters, DC only switches at the command boundary */
+/* CS stays low, so a table of commands goes out in one chip select until ILI9341_SPI_Release */
+void ILI9341_SPI_Command(uint8_t Command, const uint8_t* Parameters, uint16_t Count)
+{
+	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
+	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_RESET);
+	ILI9341_SPI_Send(Command);
+	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
+	if(Count)
+	{
+		HAL_SPI_Transmit(HSPI_INSTANCE, (uint8_t*)Parameters, Count, 1);
+	}
+}
+
+/* Sends column, page and memory write commands with CS held low, DC only switches at command boundaries */
+/* Leaves CS low and DC high so pixel data can follow directly */
+void ILI9341_SPI_Window(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2)
+{
+	unsigned char Column[4] = {X1>>8, X1, X2>>8, X2};
+	unsigned char Page[4] = {Y1>>8, Y1, Y2>>8, Y2};
+
+	ILI9341_SPI_Frame_Size(SPI_DATASIZE_8BIT);
+	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
+
+	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_RESET);
+	ILI9341_SPI_Send(0x2A);
+	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
+	HAL_SPI_Transmit(HSPI_INSTANCE, Column, 4, 1);
+
+	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_RESET);
+	ILI9341_SPI_Send(0x2B);
+	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
+	HAL_SPI_Transmit(HSPI_INSTANCE, Page, 4, 1);
+
+	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_RESET);
+	ILI9341_SPI_Send(0x2C);
+	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
+}
+
+/* Sends one pixel in a 16 bit frame and ends the chip select */
+void ILI9341_SPI_Pixel(uint16_t Colour)
+{
+	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
+	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
+	ILI9341_SPI_Frame_Size(SPI_DATASIZE_16BIT);
+	HAL_SPI_Transmit(HSPI_INSTANCE, (uint8_t*)&Colour, 1, 1);
+	ILI9341_SPI_Frame_Size(SPI_DATASIZE_8BIT);
+	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
+}
+
+//POLLING TRANSPORT
+
+/* Sends Size frames of pixel data polled, in blocks HAL_SPI_Transmit can count */
+static void ILI9341_SPI_Polled_Data(const unsigned char* Data, uint32_t Size, uint32_t Data_Size)
+{
+	uint8_t Frame_Bytes = (Data_Size == SPI_DATASIZE_16BIT) ? 2 : 1;
+
+	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
+	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
+	ILI9341_SPI_Frame_Size(Data_Size);
+	while(Size)
+	{
+		uint16_t Block = (Size > 0xFFFF) ? 0xFFFF : Size;
+		HAL_SPI_Transmit(HSPI_INSTANCE, (uint8_t*)Data, Block, HAL_MAX_DELAY);
+		Data += (uint32_t)Block*Frame_Bytes;
+		Size -= Block;
+	}
+	ILI9341_SPI_Frame_Size(SPI_DATASIZE_8BIT);
+	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
+}
+
+static void ILI9341_SPI_Polled_Pixels(const uint16_t* Colours, uint32_t Size)
+{
+	if(Size == 0) return;
+	ILI9341_SPI_Polled_Data((const unsigned char*)Colours, Size, SPI_DATASIZE_16BIT);
+}
+
+static void ILI9341_SPI_Polled_Bytes(const unsigned char* Data, uint32_t Size)
+{
+	if(Size == 0) return;
+	ILI9341_SPI_Polled_Data(Data, Size, SPI_DATASIZE_8BIT);
+}
+
+/* Sends the colour from a short buffer over and over */
+static void ILI9341_SPI_Polled_Repeat(uint16_t Colour, uint32_t Size)
+{
+	if(Size == 0) return;
+	if(Size == 1)
+	{
+		ILI9341_SPI_Pixel(Colour);
+		return;
+	}
+
+	uint16_t Count = (Size > REPEAT_PIXELS) ? REPEAT_PIXELS : Size;
+	for(uint16_t i = 0; i < Count; i++) Repeat_Buffer[i] = Colour;
+
+	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
+	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
+	ILI9341_SPI_Frame_Size(SPI_DATASIZE_16BIT);
+	while(Size)
+	{
+		uint16_t Block = (Size > Count) ? Count : Size;
+		HAL_SPI_Transmit(HSPI_INSTANCE, (uint8_t*)Repeat_Buffer, Block, HAL_MAX_DELAY);
+		Size -= Block;
+	}
+	ILI9341_SPI_Frame_Size(SPI_DATASIZE_8BIT);
+	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
+}
+
+/* Every step of the display list is sent before it returns, so the whole list is worked off here */
+static void ILI9341_SPI_Polled_Run_Queue(void)
+{
+	while(ILI9341_Queue_Next());
+	ILI9341_SPI_Release();
+}
+
+static uint8_t ILI9341_SPI_Polled_Busy(void)
+{
+	return 0;
+}
+
+static uint8_t ILI9341_SPI_Polled_Reading(const void* Buffer)
+{
+	(void)Buffer;
+	return 0;
+}
+
+const ILI9341_Transport ILI9341_Transport_SPI_Polling =
+{
+	ILI9341_SPI_Init,
+	ILI9341_SPI_Command,
+	ILI9341_SPI_Window,
+	ILI9341_SPI_Polled_Pixels,
+	ILI9341_SPI_Polled_Bytes,
+	ILI9341_SPI_Polled_Repeat,
+	ILI9341_SPI_Release,
+	ILI9341_SPI_Polled_Run_Queue,
+	ILI9341_SPI_Polled_Busy,
+	ILI9341_SPI_Polled_Reading,
+};
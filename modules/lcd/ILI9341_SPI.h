@@ -0,0 +1,32 @@
+//-----------------------------------
+//	ILI9341 on SPI5
+//-----------------------------------
+//
+//	Pins, SPI5 and the polled writes both SPI transports share, see ILI9341_Transport.h. Chip select, D/C and
+//	the SPI instance are configured in ILI9341_STM32_Driver.h.
+//
+//	Pixels are sent in 16 bit SPI frames: the buffers hold native uint16_t colours and the SPI puts the high byte
+//	on the wire first, so no byte swapping is needed. Commands and parameters use 8 bit frames, every write
+//	switches SPI5 back when it is done.
+//
+//-----------------------------------
+
+#ifndef ILI9341_SPI_H
+#define ILI9341_SPI_H
+
+#include "stm32f4xx_hal.h"
+
+extern SPI_HandleTypeDef hspi5;
+extern DMA_HandleTypeDef hdma_spi5_tx;
+
+void ILI9341_SPI_Init(void);
+void ILI9341_SPI_Send(unsigned char SPI_Data);
+void ILI9341_SPI_Frame_Size(uint32_t Data_Size);
+void ILI9341_SPI_Release(void);
+
+//POLLED, THE CALLER MAKES SURE NO TRANSFER IS RUNNING
+void ILI9341_SPI_Command(uint8_t Command, const uint8_t* Parameters, uint16_t Count);
+void ILI9341_SPI_Window(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2);
+void ILI9341_SPI_Pixel(uint16_t Colour);
+
+#endif
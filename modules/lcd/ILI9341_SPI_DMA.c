@@ -0,0 +1,310 @@
+//-----------------------------------
+//	ILI9341 on SPI5 with DMA
+//-----------------------------------
+//
+//	ILI9341_Transport_SPI_DMA: pixel data is streamed to SPI5 by DMA2 Stream6 while the drawing calls return.
+//	Commands and windows are sent polled once the running transfer has finished, so callers only need
+//	ILI9341_Wait_Idle() when they want to be sure the pixels have reached the panel.
+//
+//	Solid fills do not need a buffer: the DMA reads one colour word with memory increment disabled. Pixel arrays
+//	in flash are read in place. One job can wait behind the running one, the interrupt starts it.
+//
+//	With the display list of ILI9341_Queue.h active, the transfer interrupt also opens the address windows and
+//	starts the transfers of the queued drawing commands.
+//
+//-----------------------------------
+
+#include <lcd/ILI9341_SPI.h>
+#include <lcd/ILI9341_STM32_Driver.h>
+#include <lcd/ILI9341_Transport.h>
+#include <lcd/ILI9341_Queue.h>
+#include "stm32f4xx.h"
+
+DMA_HandleTypeDef hdma_spi5_tx;
+
+/* DMA transmit state ------------------------------------------------------------------*/
+/* One DMA job sends Block items Repeat times and then the first Remainder items once more */
+/* A JOB_WIDE job sends 16 bit frames, one item is one native uint16_t pixel; otherwise an item is one byte */
+/* A JOB_FIXED job keeps the memory address on one colour word, so a fill costs no CPU copies at all */
+/* A JOB_ADVANCE job moves on by Block items after every block, so one job streams a whole array out of flash */
+typedef struct
+{
+	unsigned char* Buffer;
+	uint16_t Block;
+	uint32_t Repeat;
+	uint16_t Remainder;
+	uint8_t Flags;
+} ILI9341_Tx_Job;
+
+#define JOB_FIXED			0x01
+#define JOB_ADVANCE			0x02
+#define JOB_WIDE			0x04
+
+/* Largest even byte count one DMA transfer can move */
+#define FILL_BLOCK_SIZE		0xFFFE
+/* Largest pixel count one DMA transfer can move in 16 bit frames */
+#define FILL_BLOCK_PIXELS	0xFFFF
+
+/* Colour words for fixed source fills */
+static uint16_t Fill_Word[2];
+static uint8_t Fill_Word_Next = 0;
+
+static volatile ILI9341_Tx_Job Tx_Active;
+static volatile ILI9341_Tx_Job Tx_Pending;
+static volatile uint8_t Tx_Busy = 0;
+static volatile uint8_t Tx_Pending_Valid = 0;
+
+/* Set while the display list starts its transfers, they have to go out by DMA so its interrupt carries on */
+static uint8_t In_Queue = 0;
+
+/* Initialize SPI and the DMA stream */
+static void ILI9341_SPI_DMA_Init(void)
+{
+	ILI9341_SPI_Init();
+
+	//DMA FOR PIXEL DATA
+	__HAL_RCC_DMA2_CLK_ENABLE();
+
+	hdma_spi5_tx.Instance = LCD_DMA_STREAM;
+	hdma_spi5_tx.Init.Channel = LCD_DMA_CHANNEL;
+	hdma_spi5_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+	hdma_spi5_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+	hdma_spi5_tx.Init.MemInc = DMA_MINC_ENABLE;
+	hdma_spi5_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+	hdma_spi5_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+	hdma_spi5_tx.Init.Mode = DMA_NORMAL;
+	hdma_spi5_tx.Init.Priority = DMA_PRIORITY_MEDIUM;
+	hdma_spi5_tx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+
+	HAL_DMA_Init(&hdma_spi5_tx);
+	__HAL_LINKDMA(&hspi5, hdmatx, hdma_spi5_tx);
+
+	HAL_NVIC_SetPriority(LCD_DMA_IRQn, 2, 0);
+	HAL_NVIC_EnableIRQ(LCD_DMA_IRQn);
+}
+
+/* Starts one DMA transfer, the stream is disabled by hardware after each transfer so it can be reconfigured here */
+static void ILI9341_DMA_Start(unsigned char* Data, uint16_t Size, uint8_t Flags)
+{
+	uint32_t CR = LCD_DMA_STREAM->CR & ~(DMA_SxCR_MINC | DMA_SxCR_MSIZE | DMA_SxCR_PSIZE);
+
+	//16 BIT FRAMES SEND THE HIGH BYTE FIRST, SO NATIVE uint16_t PIXELS GO OUT WITHOUT A BYTE SWAP
+	if(Flags & JOB_WIDE)
+	{
+		ILI9341_SPI_Frame_Size(SPI_DATASIZE_16BIT);
+		CR |= DMA_SxCR_MSIZE_0 | DMA_SxCR_PSIZE_0;
+	}
+	else
+	{
+		ILI9341_SPI_Frame_Size(SPI_DATASIZE_8BIT);
+	}
+	if(!(Flags & JOB_FIXED)) CR |= DMA_SxCR_MINC;
+
+	//MEMORY AND PERIPHERAL SIDE HAVE THE SAME WIDTH, DIRECT MODE
+	LCD_DMA_STREAM->CR = CR;
+	LCD_DMA_STREAM->FCR = 0;
+
+	HAL_SPI_Transmit_DMA(HSPI_INSTANCE, Data, Size);
+
+	//FIFO ERROR FLAGS SHOW UP ON STREAM ENABLE AND WOULD MAKE THE HAL ABORT THE SPI TRANSFER
+	__HAL_DMA_DISABLE_IT(&hdma_spi5_tx, DMA_IT_FE);
+}
+
+/* Starts the next DMA block of the active job, returns 0 when the job is finished */
+static uint8_t ILI9341_DMA_Next_Block(void)
+{
+	if(Tx_Active.Repeat != 0)
+	{
+		Tx_Active.Repeat--;
+		ILI9341_DMA_Start(Tx_Active.Buffer, Tx_Active.Block, Tx_Active.Flags);
+		if(Tx_Active.Flags & JOB_ADVANCE) Tx_Active.Buffer += (Tx_Active.Flags & JOB_WIDE) ? Tx_Active.Block*2 : Tx_Active.Block;
+		return 1;
+	}
+	if(Tx_Active.Remainder != 0)
+	{
+		uint16_t Remainder = Tx_Active.Remainder;
+		Tx_Active.Remainder = 0;
+		ILI9341_DMA_Start(Tx_Active.Buffer, Remainder, Tx_Active.Flags);
+		return 1;
+	}
+	return 0;
+}
+
+/* Runs the display list until it has started a transfer, returns 0 when it is empty */
+static uint8_t ILI9341_DMA_Queue_Next(void)
+{
+	In_Queue = 1;
+	uint8_t Started = ILI9341_Queue_Next();
+	In_Queue = 0;
+	return Started;
+}
+
+/* Called from the DMA interrupt when a block has left the SPI */
+static void ILI9341_DMA_Block_Done(void)
+{
+	if(ILI9341_DMA_Next_Block()) return;
+
+	if(Tx_Pending_Valid)
+	{
+		Tx_Active = Tx_Pending;
+		Tx_Pending_Valid = 0;
+		if(ILI9341_DMA_Next_Block()) return;
+	}
+
+	//THE DISPLAY LIST GOES ON WITH ITS NEXT WINDOW
+	if(ILI9341_DMA_Queue_Next()) return;
+
+	//ALL DONE, COMMANDS FOLLOW IN 8 BIT FRAMES
+	ILI9341_SPI_Release();
+	ILI9341_SPI_Frame_Size(SPI_DATASIZE_8BIT);
+	Tx_Busy = 0;
+}
+
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+	if(hspi->Instance == SPI5)
+	{
+		ILI9341_DMA_Block_Done();
+	}
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+	if(hspi->Instance == SPI5)
+	{
+		//DROP THE BLOCK AND KEEP GOING, A STUCK TRANSFER WOULD BLOCK EVERY FOLLOWING DRAW CALL
+		ILI9341_DMA_Block_Done();
+	}
+}
+
+void DMA2_Stream6_IRQHandler(void)
+{
+	HAL_DMA_IRQHandler(&hdma_spi5_tx);
+}
+
+/* Returns 1 while pixel data is still being sent by DMA */
+static uint8_t ILI9341_DMA_Busy(void)
+{
+	return Tx_Busy;
+}
+
+/* Returns 1 while a running or queued DMA job reads from Buffer */
+static uint8_t ILI9341_DMA_Reading(const void* Buffer)
+{
+	return (Tx_Busy && Tx_Active.Buffer == Buffer) || (Tx_Pending_Valid && Tx_Pending.Buffer == Buffer);
+}
+
+/* Makes the job the active one and sends its first block, no transfer may be running */
+static void ILI9341_Start_Job(unsigned char* Buffer, uint16_t Size, uint32_t Repeat, uint16_t Remainder, uint8_t Flags)
+{
+	Tx_Active.Buffer = Buffer;
+	Tx_Active.Block = Size;
+	Tx_Active.Repeat = Repeat;
+	Tx_Active.Remainder = Remainder;
+	Tx_Active.Flags = Flags;
+	Tx_Busy = 1;
+
+	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
+	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
+	ILI9341_DMA_Next_Block();
+}
+
+/* Starts the job or queues it behind the running one */
+static void ILI9341_Queue_Job(unsigned char* Buffer, uint16_t Size, uint32_t Repeat, uint16_t Remainder, uint8_t Flags)
+{
+	if(Size == 0) Repeat = 0;
+	if(Repeat == 0 && Remainder == 0) return;
+
+	//THE DISPLAY LIST RUNS IN THE INTERRUPT OR WITH IT MASKED AND NOTHING ON THE WIRE
+	if(In_Queue)
+	{
+		ILI9341_Start_Job(Buffer, Size, Repeat, Remainder, Flags);
+		return;
+	}
+
+	//ONLY ONE JOB CAN WAIT BEHIND THE RUNNING ONE
+	while(Tx_Pending_Valid) ILI9341_WAIT_HOOK();
+
+	HAL_NVIC_DisableIRQ(LCD_DMA_IRQn);
+	if(Tx_Busy)
+	{
+		Tx_Pending.Buffer = Buffer;
+		Tx_Pending.Block = Size;
+		Tx_Pending.Repeat = Repeat;
+		Tx_Pending.Remainder = Remainder;
+		Tx_Pending.Flags = Flags;
+		Tx_Pending_Valid = 1;
+	}
+	else
+	{
+		ILI9341_Start_Job(Buffer, Size, Repeat, Remainder, Flags);
+	}
+	HAL_NVIC_EnableIRQ(LCD_DMA_IRQn);
+}
+
+static void ILI9341_DMA_Pixels(const uint16_t* Colours, uint32_t Size)
+{
+	//THE DMA ONLY READS, THE CAST ONLY SATISFIES THE JOB STRUCT
+	ILI9341_Queue_Job((unsigned char*)Colours, FILL_BLOCK_PIXELS, Size/FILL_BLOCK_PIXELS, Size%FILL_BLOCK_PIXELS, JOB_ADVANCE | JOB_WIDE);
+}
+
+static void ILI9341_DMA_Bytes(const unsigned char* Data, uint32_t Size)
+{
+	ILI9341_Queue_Job((unsigned char*)Data, FILL_BLOCK_SIZE, Size/FILL_BLOCK_SIZE, Size%FILL_BLOCK_SIZE, JOB_ADVANCE);
+}
+
+/* The DMA repeats a single colour word, so the cost does not depend on the size of the block */
+static void ILI9341_DMA_Repeat(uint16_t Colour, uint32_t Size)
+{
+	if(Size == 0) return;
+
+	//A SINGLE PIXEL IS CHEAPER POLLED THAN A DMA SETUP, UNLESS IT HAS TO WAIT OR THE DISPLAY LIST NEEDS THE INTERRUPT
+	if((Size == 1) && !Tx_Busy && !In_Queue)
+	{
+		ILI9341_SPI_Pixel(Colour);
+		return;
+	}
+
+	uint16_t* Word = &Fill_Word[Fill_Word_Next];
+	Fill_Word_Next ^= 1;
+	//THE DISPLAY LIST ONLY STARTS WHEN THE LAST TRANSFER IS DONE, THE ACTIVE JOB READS NOTHING THEN
+	if(!In_Queue) while(ILI9341_DMA_Reading(Word)) ILI9341_WAIT_HOOK();
+
+	//ONE 16 BIT FRAME PER PIXEL, NO BYTE SWAP
+	*Word = Colour;
+
+	ILI9341_Queue_Job((unsigned char*)Word, FILL_BLOCK_PIXELS, Size/FILL_BLOCK_PIXELS, Size%FILL_BLOCK_PIXELS, JOB_FIXED | JOB_WIDE);
+}
+
+/* Releases the panel unless a transfer is running, the interrupt does it when the last one is done */
+static void ILI9341_DMA_End(void)
+{
+	if(!Tx_Busy) ILI9341_SPI_Release();
+}
+
+/* Starts the display list if the SPI is idle, otherwise the DMA interrupt gets to it when the running transfer ends */
+static void ILI9341_DMA_Run_Queue(void)
+{
+	if(Tx_Busy) return;
+
+	HAL_NVIC_DisableIRQ(LCD_DMA_IRQn);
+	if(!Tx_Busy && !ILI9341_DMA_Queue_Next())
+	{
+		ILI9341_SPI_Release();
+	}
+	HAL_NVIC_EnableIRQ(LCD_DMA_IRQn);
+}
+
+const ILI9341_Transport ILI9341_Transport_SPI_DMA =
+{
+	ILI9341_SPI_DMA_Init,
+	ILI9341_SPI_Command,
+	ILI9341_SPI_Window,
+	ILI9341_DMA_Pixels,
+	ILI9341_DMA_Bytes,
+	ILI9341_DMA_Repeat,
+	ILI9341_DMA_End,
+	ILI9341_DMA_Run_Queue,
+	ILI9341_DMA_Busy,
+	ILI9341_DMA_Reading,
+};
@@ -82,109 +82,219 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include <lcd/ILI9341_STM32_Driver.h>
+#include <lcd/ILI9341_Shadow.h>
+#include <lcd/ILI9341_Queue.h>
+#include <lcd/ILI9341_Region.h>
+#include <lcd/ILI9341_Transport.h>
+#include <string.h>
 #include "stm32f4xx.h"
 
+/* Largest byte and pixel count the region and shadow hooks take per call */
+#define FILL_BLOCK_SIZE		0xFFFE
+#define FILL_BLOCK_PIXELS	0xFFFF
+
 /* Global Variables ------------------------------------------------------------------*/
+#if ILI9341_ROTATION_RUNTIME
 volatile uint16_t LCD_HEIGHT = ILI9341_SCREEN_HEIGHT;
 volatile uint16_t LCD_WIDTH	 = ILI9341_SCREEN_WIDTH;
+#endif
 
-SPI_HandleTypeDef hspi5;
+//TRANSPORT ALL PANEL TRAFFIC GOES THROUGH, SEE ILI9341_Transport.h
+extern const ILI9341_Transport ILI9341_TRANSPORT;
+static const ILI9341_Transport* Transport = &ILI9341_TRANSPORT;
 
-/* Initialize GPIO */
-static
-void ILI9341_GPIO_Init(void)
-{
-	GPIO_InitTypeDef gpio;
-	__GPIOC_CLK_ENABLE();
-	__GPIOD_CLK_ENABLE();
-	__GPIOF_CLK_ENABLE();
+static uint16_t Tx_Buffer[2][BURST_MAX_PIXELS];
+static uint8_t Tx_Buffer_Next = 0;
 
-	gpio.Pin = LCD_CS_PIN;
-	gpio.Mode = GPIO_MODE_OUTPUT_PP;
-	gpio.Pull = GPIO_NOPULL;
-	gpio.Speed = GPIO_SPEED_MEDIUM;
-	HAL_GPIO_Init(LCD_CS_PORT, &gpio);
+/*Switches to another transport, e.g. to draw the same screen over each of them. Waits for the old one first*/
+/*Call it before ILI9341_Init or while drawing calls go straight to the panel*/
+void ILI9341_Set_Transport(const ILI9341_Transport* New_Transport)
+{
+	ILI9341_Wait_Idle();
+	Transport = New_Transport;
+	Transport->Init();
+}
 
-	gpio.Pin = LCD_DC_PIN;
-	gpio.Mode = GPIO_MODE_OUTPUT_PP;
-	gpio.Pull = GPIO_NOPULL;
-	gpio.Speed = GPIO_SPEED_MEDIUM;
-	HAL_GPIO_Init(LCD_DC_PORT, &gpio);
+const ILI9341_Transport* ILI9341_Get_Transport(void)
+{
+	return Transport;
+}
 
-	gpio.Pin = GPIO_PIN_7 | GPIO_PIN_8 | GPIO_PIN_9;
-	gpio.Mode = GPIO_MODE_AF_PP;
-	gpio.Pull = GPIO_NOPULL;
-	gpio.Speed = GPIO_SPEED_MEDIUM;
-	gpio.Alternate = GPIO_AF5_SPI5;
-	HAL_GPIO_Init(GPIOF, &gpio);
+/* Returns 1 while pixel data is still being sent or the display list still holds commands */
+uint8_t ILI9341_Is_Busy(void)
+{
+	return Transport->Busy() || ILI9341_Queue_Pending();
 }
 
-/* Initialize SPI */
-void ILI9341_SPI_Init(void)
+/* Blocks until the last transfer has finished and the display list has run empty */
+void ILI9341_Wait_Idle(void)
 {
-	__SPI5_CLK_ENABLE();
+	while(ILI9341_Is_Busy()) ILI9341_WAIT_HOOK();
+}
 
-	hspi5.Instance = SPI5;
-	hspi5.Init.Mode = SPI_MODE_MASTER;
-	hspi5.Init.Direction = SPI_DIRECTION_2LINES;
-	hspi5.Init.DataSize = SPI_DATASIZE_8BIT;
-	hspi5.Init.CLKPolarity = SPI_POLARITY_LOW;
-	hspi5.Init.CLKPhase = SPI_PHASE_1EDGE;
-	hspi5.Init.NSS = SPI_NSS_SOFT;
-	hspi5.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_2;
-	hspi5.Init.FirstBit = SPI_FIRSTBIT_MSB;
-	hspi5.Init.TIMode = SPI_TIMODE_DISABLE;
-	hspi5.Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE;
-	hspi5.Init.CRCPolynomial = 7;
+/*Returns a transmit buffer of BURST_MAX_PIXELS colours that is not used by a running or queued transfer*/
+uint16_t* ILI9341_Get_Tx_Buffer(void)
+{
+	uint16_t* Buffer = Tx_Buffer[Tx_Buffer_Next];
+	Tx_Buffer_Next ^= 1;
 
+	while(Transport->Reading(Buffer)) ILI9341_WAIT_HOOK();
 
-	HAL_SPI_Init(&hspi5);
-	ILI9341_GPIO_Init();
+	return Buffer;
+}
 
+/*Queues Size colours of Buffer Repeat times plus Remainder colours as pixel data for the current address window*/
+/*The call returns as soon as the transfer is started or queued behind the running one*/
+void ILI9341_Send_Tx_Buffer(uint16_t* Buffer, uint16_t Size, uint32_t Repeat, uint16_t Remainder)
+{
+	if(ILI9341_Region_Active)
+	{
+		ILI9341_Region_Write_Pixels(Buffer, Size, Repeat, Remainder);
+		return;
+	}
+	if(ILI9341_Shadow_Active)
+	{
+		ILI9341_Shadow_Write_Pixels(Buffer, Size, Repeat, Remainder);
+		return;
+	}
+	if(Size != 0)
+	{
+		while(Repeat--) Transport->Write_Pixels(Buffer, Size);
+	}
+	Transport->Write_Pixels(Buffer, Remainder);
+}
 
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);	//CS OFF
+/*Streams Size bytes of pixel data for the current address window straight out of Data, without copying them*/
+/*Meant for arrays in flash: the DMA reads them while the call has long returned, so Data must stay unchanged*/
+void ILI9341_Send_Const(const unsigned char* Data, uint32_t Size)
+{
+	if(ILI9341_Region_Active)
+	{
+		while(Size)
+		{
+			uint16_t Block = (Size > FILL_BLOCK_SIZE) ? FILL_BLOCK_SIZE : Size;
+			ILI9341_Region_Write(Data, Block, 1, 0);
+			Data += Block;
+			Size -= Block;
+		}
+		return;
+	}
+	if(ILI9341_Shadow_Active)
+	{
+		while(Size)
+		{
+			uint16_t Block = (Size > FILL_BLOCK_SIZE) ? FILL_BLOCK_SIZE : Size;
+			ILI9341_Shadow_Write(Data, Block, 1, 0);
+			Data += Block;
+			Size -= Block;
+		}
+		return;
+	}
+	Transport->Write_Bytes(Data, Size);
 }
 
-/*Send data (char) to LCD*/
-void ILI9341_SPI_Send(unsigned char SPI_Data)
+/*Same as ILI9341_Send_Const for Size native RGB565 colours, sent in 16 bit frames*/
+void ILI9341_Send_Const_Pixels(const uint16_t* Colours, uint32_t Size)
 {
-	HAL_SPI_Transmit(HSPI_INSTANCE, &SPI_Data, 1, 1);
+	if(ILI9341_Region_Active)
+	{
+		while(Size)
+		{
+			uint16_t Block = (Size > FILL_BLOCK_PIXELS) ? FILL_BLOCK_PIXELS : Size;
+			ILI9341_Region_Write_Pixels(Colours, Block, 1, 0);
+			Colours += Block;
+			Size -= Block;
+		}
+		return;
+	}
+	if(ILI9341_Shadow_Active)
+	{
+		while(Size)
+		{
+			uint16_t Block = (Size > FILL_BLOCK_PIXELS) ? FILL_BLOCK_PIXELS : Size;
+			ILI9341_Shadow_Write_Pixels(Colours, Block, 1, 0);
+			Colours += Block;
+			Size -= Block;
+		}
+		return;
+	}
+	Transport->Write_Pixels(Colours, Size);
 }
 
 /* Send command (char) to LCD */
 void ILI9341_Write_Command(uint8_t Command)
 {
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_RESET);
-	ILI9341_SPI_Send(Command);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
+	ILI9341_Wait_Idle();
+	Transport->Write_Command(Command, 0, 0);
+	Transport->End();
 }
 
-/* Send Data (char) to LCD */
-void ILI9341_Write_Data(uint8_t Data)
+/* Send command (char) and its parameters to LCD */
+void ILI9341_Write_Parameters(uint8_t Command, const uint8_t* Parameters, uint16_t Count)
 {
-	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-	ILI9341_SPI_Send(Data);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
+	ILI9341_Wait_Idle();
+	Transport->Write_Command(Command, Parameters, Count);
+	Transport->End();
 }
 
-/* Set Address - Location block - to draw into */
-void ILI9341_Set_Address(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2)
+/* Waits for the running transfer and the display list, then opens the window, the panel stays selected */
+static void ILI9341_Open_Window(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2)
+{
+	ILI9341_Wait_Idle();
+	Transport->Begin_Window(X1, Y1, X2, Y2);
+}
+
+//DISPLAY LIST EXECUTION
+//
+//ILI9341_Queue_Next() is run by the transport once nothing is on the wire: in the DMA interrupt after a
+//transfer, or right away with polled transports. These functions start right away.
+//
+
+/*Opens an address window without waiting*/
+void ILI9341_Direct_Window(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2)
+{
+	Transport->Begin_Window(X1, Y1, X2, Y2);
+}
+
+/*Starts a fill of Size pixels into the open window*/
+void ILI9341_Direct_Fill(uint16_t Colour, uint32_t Size)
+{
+	Transport->Write_Repeat(Colour, Size);
+}
+
+/*Starts sending Size colours from RAM or flash into the open window, Colours must stay unchanged until the transfer is done*/
+void ILI9341_Direct_Pixels(const uint16_t* Colours, uint32_t Size)
+{
+	Transport->Write_Pixels(Colours, Size);
+}
+
+/*Transmit buffer for rendered glyphs and decoded images, free whenever the display list starts a transfer*/
+uint16_t* ILI9341_Direct_Buffer(void)
 {
-	ILI9341_Write_Command(0x2A);
-	ILI9341_Write_Data(X1>>8);
-	ILI9341_Write_Data(X1);
-	ILI9341_Write_Data(X2>>8);
-	ILI9341_Write_Data(X2);
+	return Tx_Buffer[0];
+}
 
-	ILI9341_Write_Command(0x2B);
-	ILI9341_Write_Data(Y1>>8);
-	ILI9341_Write_Data(Y1);
-	ILI9341_Write_Data(Y2>>8);
-	ILI9341_Write_Data(Y2);
+/*Starts the display list, an asynchronous transport gets to it when the running transfer ends*/
+void ILI9341_Start_Queue(void)
+{
+	Transport->Run_Queue();
+}
 
-	ILI9341_Write_Command(0x2C);
+/* Set Address - Location block - to draw into */
+void ILI9341_Set_Address(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2)
+{
+	if(ILI9341_Region_Active)
+	{
+		ILI9341_Region_Window(X1, Y1, X2, Y2);
+		return;
+	}
+	if(ILI9341_Shadow_Active)
+	{
+		ILI9341_Shadow_Window(X1, Y1, X2, Y2);
+		return;
+	}
+	ILI9341_Open_Window(X1, Y1, X2, Y2);
+	Transport->End();
 }
 
 /*HARDWARE RESET*/
@@ -199,41 +309,47 @@ HAL_GPIO_WritePin(LCD_RST_PORT, LCD_RST_PIN, GPIO_PIN_SET);
 	 */
 }
 
-/*Ser rotation of the screen - changes x0 and y0*/
-void ILI9341_Set_Rotation(uint8_t Rotation) 
+//MEMORY ACCESS CONTROL PER ORIENTATION: ROW/COLUMN EXCHANGE AND MIRRORING, BGR ORDER
+static const uint8_t ILI9341_Madctl[4] =
 {
+	0x40|0x08,					//SCREEN_VERTICAL_1
+	0x20|0x08,					//SCREEN_HORIZONTAL_1
+	0x80|0x08,					//SCREEN_VERTICAL_2
+	0x40|0x80|0x20|0x08,		//SCREEN_HORIZONTAL_2
+};
+
+//GRAM LINES RUN AGAINST THE LOGICAL AXIS IN THE MIRRORED ORIENTATIONS, NEEDED BY THE SCROLL FUNCTIONS
+#if ILI9341_ROTATION_RUNTIME
+static uint8_t Scroll_Mirrored = 0;
+#else
+#define Scroll_Mirrored		(ILI9341_ROTATION >= SCREEN_VERTICAL_2)
+#endif
+
+/*Sends the memory access control of an orientation, LCD_WIDTH and LCD_HEIGHT stay as they are*/
+/*Used by ILI9341_Draw_Image to write a picture in its own orientation*/
+void ILI9341_Write_Rotation(uint8_t Rotation)
+{
+	if(Rotation > SCREEN_HORIZONTAL_2) return;
 
-	uint8_t screen_rotation = Rotation;
-
-	ILI9341_Write_Command(0x36);
-	HAL_Delay(1);
+	ILI9341_Write_Parameters(0x36, &ILI9341_Madctl[Rotation], 1);
+}
 
-	switch(screen_rotation)
-	{
-	case SCREEN_VERTICAL_1:
-		ILI9341_Write_Data(0x40|0x08);
-		LCD_WIDTH = 240;
-		LCD_HEIGHT = 320;
-		break;
-	case SCREEN_HORIZONTAL_1:
-		ILI9341_Write_Data(0x20|0x08);
-		LCD_WIDTH  = 320;
-		LCD_HEIGHT = 240;
-		break;
-	case SCREEN_VERTICAL_2:
-		ILI9341_Write_Data(0x80|0x08);
-		LCD_WIDTH  = 240;
-		LCD_HEIGHT = 320;
-		break;
-	case SCREEN_HORIZONTAL_2:
-		ILI9341_Write_Data(0x40|0x80|0x20|0x08);
-		LCD_WIDTH  = 320;
-		LCD_HEIGHT = 240;
-		break;
-	default:
-		//EXIT IF SCREEN ROTATION NOT VALID!
-		break;
-	}
+/*Ser rotation of the screen - changes x0 and y0*/
+/*Without ILI9341_ROTATION_RUNTIME only ILI9341_ROTATION is accepted, LCD_WIDTH and LCD_HEIGHT are constants then*/
+void ILI9341_Set_Rotation(uint8_t Rotation) 
+{
+#if ILI9341_ROTATION_RUNTIME
+	if(Rotation > SCREEN_HORIZONTAL_2) return;	//EXIT IF SCREEN ROTATION NOT VALID!
+
+	ILI9341_Write_Rotation(Rotation);
+	LCD_WIDTH = (Rotation & 1) ? ILI9341_SCREEN_WIDTH : ILI9341_SCREEN_HEIGHT;
+	LCD_HEIGHT = (Rotation & 1) ? ILI9341_SCREEN_HEIGHT : ILI9341_SCREEN_WIDTH;
+	Scroll_Mirrored = (Rotation >= SCREEN_VERTICAL_2);
+#else
+	if(Rotation != ILI9341_ROTATION) return;
+
+	ILI9341_Write_Rotation(Rotation);
+#endif
 }
 
 /*Enable LCD display*/
@@ -242,143 +358,147 @@ void ILI9341_Enable(void)
 	//HAL_GPIO_WritePin(LCD_RST_PORT, LCD_RST_PIN, GPIO_PIN_SET);
 }
 
-/*Initialize LCD display*/
-void ILI9341_Init(void)
+//INITIALISATION SEQUENCE
+//
+//Each entry is the command byte, the number of parameter bytes and the parameters.
+//Software reset and sleep out are sent separately because they need delays.
+//
+static const uint8_t ILI9341_Init_Table[] =
+{
+	0xCB, 5, 0x39, 0x2C, 0x00, 0x34, 0x02,		//POWER CONTROL A
+	0xCF, 3, 0x00, 0xC1, 0x30,					//POWER CONTROL B
+	0xE8, 3, 0x85, 0x00, 0x78,					//DRIVER TIMING CONTROL A
+	0xEA, 2, 0x00, 0x00,						//DRIVER TIMING CONTROL B
+	0xED, 4, 0x64, 0x03, 0x12, 0x81,			//POWER ON SEQUENCE CONTROL
+	0xF7, 1, 0x20,								//PUMP RATIO CONTROL
+	0xC0, 1, 0x23,								//POWER CONTROL,VRH[5:0]
+	0xC1, 1, 0x10,								//POWER CONTROL,SAP[2:0];BT[3:0]
+	0xC5, 2, 0x3E, 0x28,						//VCM CONTROL
+	0xC7, 1, 0x86,								//VCM CONTROL 2
+	0x36, 1, 0x48,								//MEMORY ACCESS CONTROL
+	0x3A, 1, 0x55,								//PIXEL FORMAT
+	0xB1, 2, 0x00, 0x18,						//FRAME RATIO CONTROL, STANDARD RGB COLOR
+	0xB6, 3, 0x08, 0x82, 0x27,					//DISPLAY FUNCTION CONTROL
+	0xF2, 1, 0x00,								//3GAMMA FUNCTION DISABLE
+	0x26, 1, 0x01,								//GAMMA CURVE SELECTED
+	0xE0, 15, 0x0F, 0x31, 0x2B, 0x0C, 0x0E, 0x08, 0x4E, 0xF1,
+			  0x37, 0x07, 0x10, 0x03, 0x0E, 0x09, 0x00,		//POSITIVE GAMMA CORRECTION
+	0xE1, 15, 0x00, 0x0E, 0x14, 0x03, 0x11, 0x07, 0x31, 0xC1,
+			  0x48, 0x08, 0x0F, 0x0C, 0x31, 0x36, 0x0F,		//NEGATIVE GAMMA CORRECTION
+};
+
+//DATASHEET MINIMUM WAITS IN MS
+#define ILI9341_RESET_DELAY			5
+#define ILI9341_SLEEP_OUT_DELAY		5
+#define ILI9341_SLEEP_OUT_SETTLE	120
+
+/* Sends a table of commands and parameters in one chip select, DC only switches at command boundaries */
+static void ILI9341_Send_Command_Table(const uint8_t* Table, uint16_t Size)
+{
+	uint16_t i = 0;
+
+	ILI9341_Wait_Idle();
+	while(i < Size)
+	{
+		uint8_t Arguments = Table[i+1];
+
+		Transport->Write_Command(Table[i], &Table[i+2], Arguments);
+		i += 2 + Arguments;
+	}
+	Transport->End();
+}
+
+static uint32_t Sleep_Out_Tick;
+
+/*Starts the initialisation, sleep out is sent right after the reset and the register setup runs while the panel wakes up*/
+/*The display stays off, GRAM can already be written until ILI9341_Init_Finish() switches it on*/
+void ILI9341_Init_Start(void)
 {
 
 	ILI9341_Enable();
-	ILI9341_SPI_Init();
+	Transport->Init();
 	ILI9341_Reset();
 
 	//SOFTWARE RESET
 	ILI9341_Write_Command(0x01);
-	HAL_Delay(1000);
-
-	//POWER CONTROL A
-	ILI9341_Write_Command(0xCB);
-	ILI9341_Write_Data(0x39);
-	ILI9341_Write_Data(0x2C);
-	ILI9341_Write_Data(0x00);
-	ILI9341_Write_Data(0x34);
-	ILI9341_Write_Data(0x02);
-
-	//POWER CONTROL B
-	ILI9341_Write_Command(0xCF);
-	ILI9341_Write_Data(0x00);
-	ILI9341_Write_Data(0xC1);
-	ILI9341_Write_Data(0x30);
-
-	//DRIVER TIMING CONTROL A
-	ILI9341_Write_Command(0xE8);
-	ILI9341_Write_Data(0x85);
-	ILI9341_Write_Data(0x00);
-	ILI9341_Write_Data(0x78);
-
-	//DRIVER TIMING CONTROL B
-	ILI9341_Write_Command(0xEA);
-	ILI9341_Write_Data(0x00);
-	ILI9341_Write_Data(0x00);
-
-	//POWER ON SEQUENCE CONTROL
-	ILI9341_Write_Command(0xED);
-	ILI9341_Write_Data(0x64);
-	ILI9341_Write_Data(0x03);
-	ILI9341_Write_Data(0x12);
-	ILI9341_Write_Data(0x81);
-
-	//PUMP RATIO CONTROL
-	ILI9341_Write_Command(0xF7);
-	ILI9341_Write_Data(0x20);
-
-	//POWER CONTROL,VRH[5:0]
-	ILI9341_Write_Command(0xC0);
-	ILI9341_Write_Data(0x23);
-
-	//POWER CONTROL,SAP[2:0];BT[3:0]
-	ILI9341_Write_Command(0xC1);
-	ILI9341_Write_Data(0x10);
-
-	//VCM CONTROL
-	ILI9341_Write_Command(0xC5);
-	ILI9341_Write_Data(0x3E);
-	ILI9341_Write_Data(0x28);
-
-	//VCM CONTROL 2
-	ILI9341_Write_Command(0xC7);
-	ILI9341_Write_Data(0x86);
-
-	//MEMORY ACCESS CONTROL
-	ILI9341_Write_Command(0x36);
-	ILI9341_Write_Data(0x48);
-
-	//PIXEL FORMAT
-	ILI9341_Write_Command(0x3A);
-	ILI9341_Write_Data(0x55);
-
-	//FRAME RATIO CONTROL, STANDARD RGB COLOR
-	ILI9341_Write_Command(0xB1);
-	ILI9341_Write_Data(0x00);
-	ILI9341_Write_Data(0x18);
-
-	//DISPLAY FUNCTION CONTROL
-	ILI9341_Write_Command(0xB6);
-	ILI9341_Write_Data(0x08);
-	ILI9341_Write_Data(0x82);
-	ILI9341_Write_Data(0x27);
-
-	//3GAMMA FUNCTION DISABLE
-	ILI9341_Write_Command(0xF2);
-	ILI9341_Write_Data(0x00);
-
-	//GAMMA CURVE SELECTED
-	ILI9341_Write_Command(0x26);
-	ILI9341_Write_Data(0x01);
-
-	//POSITIVE GAMMA CORRECTION
-	ILI9341_Write_Command(0xE0);
-	ILI9341_Write_Data(0x0F);
-	ILI9341_Write_Data(0x31);
-	ILI9341_Write_Data(0x2B);
-	ILI9341_Write_Data(0x0C);
-	ILI9341_Write_Data(0x0E);
-	ILI9341_Write_Data(0x08);
-	ILI9341_Write_Data(0x4E);
-	ILI9341_Write_Data(0xF1);
-	ILI9341_Write_Data(0x37);
-	ILI9341_Write_Data(0x07);
-	ILI9341_Write_Data(0x10);
-	ILI9341_Write_Data(0x03);
-	ILI9341_Write_Data(0x0E);
-	ILI9341_Write_Data(0x09);
-	ILI9341_Write_Data(0x00);
-
-	//NEGATIVE GAMMA CORRECTION
-	ILI9341_Write_Command(0xE1);
-	ILI9341_Write_Data(0x00);
-	ILI9341_Write_Data(0x0E);
-	ILI9341_Write_Data(0x14);
-	ILI9341_Write_Data(0x03);
-	ILI9341_Write_Data(0x11);
-	ILI9341_Write_Data(0x07);
-	ILI9341_Write_Data(0x31);
-	ILI9341_Write_Data(0xC1);
-	ILI9341_Write_Data(0x48);
-	ILI9341_Write_Data(0x08);
-	ILI9341_Write_Data(0x0F);
-	ILI9341_Write_Data(0x0C);
-	ILI9341_Write_Data(0x31);
-	ILI9341_Write_Data(0x36);
-	ILI9341_Write_Data(0x0F);
+	HAL_Delay(ILI9341_RESET_DELAY);
 
 	//EXIT SLEEP
 	ILI9341_Write_Command(0x11);
-	HAL_Delay(120);
+	Sleep_Out_Tick = HAL_GetTick();
+	HAL_Delay(ILI9341_SLEEP_OUT_DELAY);
+
+	ILI9341_Send_Command_Table(ILI9341_Init_Table, sizeof(ILI9341_Init_Table));
+
+	//STARTING ROTATION
+	ILI9341_Set_Rotation(ILI9341_ROTATION);
+}
+
+/*Switches the display on once the panel has settled after sleep out, only waits for what is left of that time*/
+void ILI9341_Init_Finish(void)
+{
+	while((HAL_GetTick() - Sleep_Out_Tick) < ILI9341_SLEEP_OUT_SETTLE);
 
 	//TURN ON DISPLAY
 	ILI9341_Write_Command(0x29);
+}
 
-	//STARTING ROTATION
-	ILI9341_Set_Rotation(SCREEN_VERTICAL_1);
+/*Initialize LCD display*/
+void ILI9341_Init(void)
+{
+	ILI9341_Init_Start();
+	ILI9341_Init_Finish();
+}
+
+//HARDWARE VERTICAL SCROLLING
+//
+//The panel shows its 320 GRAM lines as top fixed area, scroll area and bottom fixed area. The lines run along
+//the long side of the screen: along Y in the vertical and along X in the horizontal orientations.
+//Start and Height are given in the current orientation, so set the rotation first.
+//
+static uint16_t Scroll_Top_Fixed = 0;
+static uint16_t Scroll_Height = 0;
+
+/*Defines the band of Height lines from Start on that scrolls, everything outside stays fixed. Resets the offset to 0*/
+void ILI9341_Set_Scroll_Area(uint16_t Start, uint16_t Height)
+{
+	if((Height == 0) || (Start+Height > ILI9341_SCROLL_LINES)) return;
+
+	uint16_t Top_Fixed = Scroll_Mirrored ? ILI9341_SCROLL_LINES-Start-Height : Start;
+	uint16_t Bottom_Fixed = ILI9341_SCROLL_LINES-Top_Fixed-Height;
+	const uint8_t Table[] =
+	{
+		0x33, 6, Top_Fixed>>8, Top_Fixed, Height>>8, Height, Bottom_Fixed>>8, Bottom_Fixed,		//VERTICAL SCROLLING DEFINITION
+	};
+
+	ILI9341_Send_Command_Table(Table, sizeof(Table));
+	Scroll_Top_Fixed = Top_Fixed;
+	Scroll_Height = Height;
+	ILI9341_Scroll(0);
+}
+
+/*Rolls the scroll area: the line Start+Offset is shown first, the lines before it follow at the end of the area*/
+/*Drawing still uses the unscrolled coordinates*/
+void ILI9341_Scroll(uint16_t Offset)
+{
+	if(Scroll_Height == 0) return;
+
+	Offset %= Scroll_Height;
+	if(Scroll_Mirrored && Offset) Offset = Scroll_Height-Offset;
+
+	uint16_t Line = Scroll_Top_Fixed+Offset;
+	const uint8_t Table[] =
+	{
+		0x37, 2, Line>>8, Line,		//VERTICAL SCROLLING START ADDRESS
+	};
+
+	ILI9341_Send_Command_Table(Table, sizeof(Table));
+}
+
+/*Ends scrolling, the whole screen is shown unscrolled again*/
+void ILI9341_Scroll_Off(void)
+{
+	ILI9341_Set_Scroll_Area(0, ILI9341_SCROLL_LINES);
 }
 
 //INTERNAL FUNCTION OF LIBRARY, USAGE NOT RECOMENDED, USE Draw_Pixel INSTEAD
@@ -386,62 +506,50 @@ void ILI9341_Init(void)
 void ILI9341_Draw_Colour(uint16_t Colour)
 {
 	//SENDS COLOUR
-	unsigned char TempBuffer[2] = {Colour>>8, Colour};
-	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-	HAL_SPI_Transmit(HSPI_INSTANCE, TempBuffer, 2, 1);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
+	if(ILI9341_Region_Active)
+	{
+		ILI9341_Region_Fill(Colour, 1);
+		return;
+	}
+	if(ILI9341_Shadow_Active)
+	{
+		ILI9341_Shadow_Fill(Colour, 1);
+		return;
+	}
+	ILI9341_Wait_Idle();
+	Transport->Write_Repeat(Colour, 1);
 }
 
 //INTERNAL FUNCTION OF LIBRARY
 /*Sends block colour information to LCD*/
+/*The transport repeats a single colour, with DMA the cost does not depend on the size of the block*/
+/*Returns while the DMA is still sending, the next command waits for it*/
 void ILI9341_Draw_Colour_Burst(uint16_t Colour, uint32_t Size)
 {
-	//SENDS COLOUR
-	uint32_t Buffer_Size = 0;
-	if((Size*2) < BURST_MAX_SIZE)
+	if(Size == 0) return;
+	if(ILI9341_Region_Active)
 	{
-		Buffer_Size = Size;
+		ILI9341_Region_Fill(Colour, Size);
+		return;
 	}
-	else
+	if(ILI9341_Shadow_Active)
 	{
-		Buffer_Size = BURST_MAX_SIZE;
+		ILI9341_Shadow_Fill(Colour, Size);
+		return;
 	}
-
-	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-
-	unsigned char chifted = 	Colour>>8;;
-	unsigned char burst_buffer[Buffer_Size];
-	for(uint32_t j = 0; j < Buffer_Size; j+=2)
-	{
-		burst_buffer[j] = 	chifted;
-		burst_buffer[j+1] = Colour;
-	}
-
-	uint32_t Sending_Size = Size*2;
-	uint32_t Sending_in_Block = Sending_Size/Buffer_Size;
-	uint32_t Remainder_from_block = Sending_Size%Buffer_Size;
-
-	if(Sending_in_Block != 0)
-	{
-		for(uint32_t j = 0; j < (Sending_in_Block); j++)
-		{
-			HAL_SPI_Transmit(HSPI_INSTANCE, (unsigned char *)burst_buffer, Buffer_Size, 10);
-		}
-	}
-
-	//REMAINDER!
-	HAL_SPI_Transmit(HSPI_INSTANCE, (unsigned char *)burst_buffer, Remainder_from_block, 10);
-
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
+	Transport->Write_Repeat(Colour, Size);
 }
 
 //FILL THE ENTIRE SCREEN WITH SELECTED COLOUR (either #define-d ones or custom 16bit)
 /*Sets address (entire screen) and Sends Height*Width ammount of colour information to LCD*/
 void ILI9341_Fill_Screen(uint16_t Colour)
 {
-	ILI9341_Set_Address(0,0,LCD_WIDTH,LCD_HEIGHT);
+	if(ILI9341_Queue_Active)
+	{
+		ILI9341_Queue_Fill(0, 0, LCD_WIDTH, LCD_HEIGHT, Colour);
+		return;
+	}
+	ILI9341_Set_Address(0,0,LCD_WIDTH-1,LCD_HEIGHT-1);
 	ILI9341_Draw_Colour_Burst(Colour, LCD_WIDTH*LCD_HEIGHT);
 }
 
@@ -449,51 +557,62 @@ void ILI9341_Fill_Screen(uint16_t Colour)
 //
 //Location is dependant on screen orientation. x0 and y0 locations change with orientations.
 //Using pixels to draw big simple structures is not recommended as it is really slow
-//Try using either rectangles or lines if possible
+//Try using either rectangles, lines or ILI9341_Draw_Pixels if possible
 //
 void ILI9341_Draw_Pixel(uint16_t X,uint16_t Y,uint16_t Colour) 
 {
 	if((X >=LCD_WIDTH) || (Y >=LCD_HEIGHT)) return;	//OUT OF BOUNDS!
 
-	//ADDRESS
-	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_RESET);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-	ILI9341_SPI_Send(0x2A);
-	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
-
-	//XDATA
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-	unsigned char Temp_Buffer[4] = {X>>8,X, (X+1)>>8, (X+1)};
-	HAL_SPI_Transmit(HSPI_INSTANCE, Temp_Buffer, 4, 1);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
-
-	//ADDRESS
-	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_RESET);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-	ILI9341_SPI_Send(0x2B);
-	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
-
-	//YDATA
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-	unsigned char Temp_Buffer1[4] = {Y>>8,Y, (Y+1)>>8, (Y+1)};
-	HAL_SPI_Transmit(HSPI_INSTANCE, Temp_Buffer1, 4, 1);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
-
-	//ADDRESS
-	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_RESET);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-	ILI9341_SPI_Send(0x2C);
-	HAL_GPIO_WritePin(LCD_DC_PORT, LCD_DC_PIN, GPIO_PIN_SET);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
-
-	//COLOUR
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_RESET);
-	unsigned char Temp_Buffer2[2] = {Colour>>8, Colour};
-	HAL_SPI_Transmit(HSPI_INSTANCE, Temp_Buffer2, 2, 1);
-	HAL_GPIO_WritePin(LCD_CS_PORT, LCD_CS_PIN, GPIO_PIN_SET);
+	if(ILI9341_Queue_Active)
+	{
+		ILI9341_Queue_Fill(X, Y, 1, 1, Colour);
+		return;
+	}
+
+	if(ILI9341_Region_Active)
+	{
+		ILI9341_Region_Window(X, Y, X, Y);
+		ILI9341_Region_Fill(Colour, 1);
+		return;
+	}
+
+	if(ILI9341_Shadow_Active)
+	{
+		ILI9341_Shadow_Window(X, Y, X, Y);
+		ILI9341_Shadow_Fill(Colour, 1);
+		return;
+	}
+
+	//ADDRESS AND COLOUR IN ONE CHIP SELECT
+	ILI9341_Open_Window(X, Y, X, Y);
+	Transport->Write_Repeat(Colour, 1);
+}
+
+//DRAW A BATCH OF PIXELS INTO ONE WIDTH x HEIGHT WINDOW
+//
+//Colours are given row by row. The window is set up once and the pixels are streamed through the DMA buffers.
+//The window has to lie completely on the screen
+//
+void ILI9341_Draw_Pixels(uint16_t X, uint16_t Y, uint16_t Width, uint16_t Height, const uint16_t* Colours)
+{
+	if((Width == 0) || (Height == 0)) return;
+	if((X+Width-1 >=LCD_WIDTH) || (Y+Height-1 >=LCD_HEIGHT)) return;
+
+	ILI9341_Set_Address(X, Y, X+Width-1, Y+Height-1);
 
+	uint32_t Pixels = (uint32_t)Width*Height;
+	while(Pixels)
+	{
+		uint32_t Block = Pixels;
+		if(Block > BURST_MAX_PIXELS) Block = BURST_MAX_PIXELS;
+
+		uint16_t* Buffer = ILI9341_Get_Tx_Buffer();
+		memcpy(Buffer, Colours, Block*2);
+		ILI9341_Send_Tx_Buffer(Buffer, Block, 1, 0);
+
+		Colours += Block;
+		Pixels -= Block;
+	}
 }
 
 //DRAW RECTANGLE OF SET SIZE AND HEIGTH AT X and Y POSITION WITH CUSTOM COLOUR
@@ -505,6 +624,7 @@ void ILI9341_Draw_Pixel(uint16_t X,uint16_t Y,uint16_t Colour)
 void ILI9341_Draw_Rectangle(uint16_t X, uint16_t Y, uint16_t Width, uint16_t Height, uint16_t Colour)
 {
 	if((X >=LCD_WIDTH) || (Y >=LCD_HEIGHT)) return;
+	if((Width == 0) || (Height == 0)) return;
 	if((X+Width-1)>=LCD_WIDTH)
 	{
 		Width=LCD_WIDTH-X;
@@ -513,30 +633,49 @@ void ILI9341_Draw_Rectangle(uint16_t X, uint16_t Y, uint16_t Width, uint16_t Hei
 	{
 		Height=LCD_HEIGHT-Y;
 	}
+	if(ILI9341_Queue_Active)
+	{
+		ILI9341_Queue_Fill(X, Y, Width, Height, Colour);
+		return;
+	}
 	ILI9341_Set_Address(X, Y, X+Width-1, Y+Height-1);
 	ILI9341_Draw_Colour_Burst(Colour, Height*Width);
 }
 
 //DRAW LINE FROM X,Y LOCATION to X+Width,Y LOCATION
+//Horizontal run of the span API: one window and one fixed colour DMA job per call
 void ILI9341_Draw_Horizontal_Line(uint16_t X, uint16_t Y, uint16_t Width, uint16_t Colour)
 {
 	if((X >=LCD_WIDTH) || (Y >=LCD_HEIGHT)) return;
+	if(Width == 0) return;
 	if((X+Width-1)>=LCD_WIDTH)
 	{
 		Width=LCD_WIDTH-X;
 	}
+	if(ILI9341_Queue_Active)
+	{
+		ILI9341_Queue_Fill(X, Y, Width, 1, Colour);
+		return;
+	}
 	ILI9341_Set_Address(X, Y, X+Width-1, Y);
 	ILI9341_Draw_Colour_Burst(Colour, Width);
 }
 
 //DRAW LINE FROM X,Y LOCATION to X,Y+Height LOCATION
+//Vertical run of the span API: one window and one fixed colour DMA job per call
 void ILI9341_Draw_Vertical_Line(uint16_t X, uint16_t Y, uint16_t Height, uint16_t Colour)
 {
 	if((X >=LCD_WIDTH) || (Y >=LCD_HEIGHT)) return;
+	if(Height == 0) return;
 	if((Y+Height-1)>=LCD_HEIGHT)
 	{
 		Height=LCD_HEIGHT-Y;
 	}
+	if(ILI9341_Queue_Active)
+	{
+		ILI9341_Queue_Fill(X, Y, 1, Height, Colour);
+		return;
+	}
 	ILI9341_Set_Address(X, Y, X, Y+Height-1);
 	ILI9341_Draw_Colour_Burst(Colour, Height);
 }
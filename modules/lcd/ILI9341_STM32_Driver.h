@@ -79,6 +79,26 @@
 //	-library is now ready to be used. Driver library has only basic functions, for more advanced functions see ILI9341_GFX library	
 //
 //-----------------------------------
+//	DMA transfers
+//-----------------------------------
+//
+//	The driver does not touch the SPI, the DMA or the CS/DC pins itself: address windows, commands and pixel data
+//	go through a transport, see ILI9341_Transport.h. The default one streams pixel data to SPI5 by DMA2 Stream6
+//	out of two alternating transmit buffers. Drawing calls fill one buffer while the other one is still on the
+//	wire and return before the last block has been sent. Every command write waits for the running transfer
+//	first, so callers only need ILI9341_Wait_Idle() when they want to be sure the pixels have reached the panel.
+//	ILI9341_Is_Busy() reports a running transfer.
+//	Solid fills do not use the buffers: the DMA reads one colour word with memory increment disabled.
+//	Pixel arrays in flash do not use them either, ILI9341_Send_Const() lets the DMA read them in place.
+//
+//	Pixels are sent in 16 bit SPI frames: the buffers hold native uint16_t colours and the SPI puts the
+//	high byte on the wire first, so no byte swapping is needed and the DMA moves one half-word per pixel.
+//	Commands and parameters use 8 bit frames, the transport switches SPI5 back when a transfer has finished.
+//
+//	With the display list of ILI9341_Queue.h active, the DMA interrupt also opens the address windows and
+//	starts the transfers of the queued drawing commands, see there.
+//
+//-----------------------------------
 
 
 #ifndef ILI9341_STM32_DRIVER_H
@@ -90,6 +110,9 @@
 #define ILI9341_SCREEN_HEIGHT 240 
 #define ILI9341_SCREEN_WIDTH 	320
 
+//GRAM LINES THE HARDWARE SCROLL WORKS ON, THE LONG SIDE OF THE SCREEN
+#define ILI9341_SCROLL_LINES	ILI9341_SCREEN_WIDTH
+
 
 //SPI INSTANCE
 #define HSPI_INSTANCE							&hspi5
@@ -106,8 +129,21 @@
 //#define	LCD_RST_PORT							GPIOC
 //#define	LCD_RST_PIN								RST_Pin
 
+//DMA STREAM FOR SPI5_TX (DMA2 STREAM4 IS TAKEN BY potis_DMA, SO STREAM6 / CHANNEL7 IS USED)
+#define LCD_DMA_STREAM						DMA2_Stream6
+#define LCD_DMA_CHANNEL						DMA_CHANNEL_7
+#define LCD_DMA_IRQn							DMA2_Stream6_IRQn
+
+
+//RUNS IN EVERY LOOP THAT WAITS FOR THE SPI OR THE DISPLAY LIST. EMPTY ON THE BOARD, THE HOST BUILD IN tools/lcd_host
+//LETS ITS DMA CLOCK RUN THERE AND COUNTS THE TIME THE CPU SPENDS WAITING
+#ifndef ILI9341_WAIT_HOOK
+#define ILI9341_WAIT_HOOK()
+#endif
+
 
 #define BURST_MAX_SIZE 	500
+#define BURST_MAX_PIXELS	(BURST_MAX_SIZE/2)
 
 #define BLACK       0x0000      
 #define NAVY        0x000F      
@@ -135,22 +171,63 @@
 #define SCREEN_HORIZONTAL_2		3
 
 
-extern SPI_HandleTypeDef hspi5;
+//ORIENTATION OF THE SCREEN, SET BY ILI9341_Init. IT IS FIXED AT BUILD TIME: LCD_WIDTH AND LCD_HEIGHT ARE CONSTANTS,
+//SO EVERY BOUNDS CHECK AND WINDOW CALCULATION FOLDS INTO IMMEDIATES. DEFINE ILI9341_ROTATION IN THE PROJECT'S
+//SYMBOLS TO CHOOSE ANOTHER ONE, ILI9341_ROTATION_RUNTIME=1 BRINGS BACK ILI9341_Set_Rotation FOR ALL FOUR
+#ifndef ILI9341_ROTATION
+#define ILI9341_ROTATION			SCREEN_VERTICAL_2
+#endif
+
+#ifndef ILI9341_ROTATION_RUNTIME
+#define ILI9341_ROTATION_RUNTIME	0
+#endif
+
+#if ILI9341_ROTATION_RUNTIME
+extern volatile uint16_t LCD_HEIGHT;
+extern volatile uint16_t LCD_WIDTH;
+#elif (ILI9341_ROTATION == SCREEN_VERTICAL_1) || (ILI9341_ROTATION == SCREEN_VERTICAL_2)
+#define LCD_WIDTH					ILI9341_SCREEN_HEIGHT
+#define LCD_HEIGHT					ILI9341_SCREEN_WIDTH
+#elif (ILI9341_ROTATION == SCREEN_HORIZONTAL_1) || (ILI9341_ROTATION == SCREEN_HORIZONTAL_2)
+#define LCD_WIDTH					ILI9341_SCREEN_WIDTH
+#define LCD_HEIGHT					ILI9341_SCREEN_HEIGHT
+#else
+#error "ILI9341_ROTATION must be one of SCREEN_VERTICAL_1, SCREEN_HORIZONTAL_1, SCREEN_VERTICAL_2, SCREEN_HORIZONTAL_2"
+#endif
 
-void ILI9341_SPI_Init(void);
-void ILI9341_SPI_Send(unsigned char SPI_Data);
 void ILI9341_Write_Command(uint8_t Command);
-void ILI9341_Write_Data(uint8_t Data);
+void ILI9341_Write_Parameters(uint8_t Command, const uint8_t* Parameters, uint16_t Count);
 void ILI9341_Set_Address(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2);
 void ILI9341_Reset(void);
 void ILI9341_Set_Rotation(uint8_t Rotation);
+void ILI9341_Write_Rotation(uint8_t Rotation);
 void ILI9341_Enable(void);
 void ILI9341_Init(void);
+void ILI9341_Init_Start(void);
+void ILI9341_Init_Finish(void);
+void ILI9341_Set_Scroll_Area(uint16_t Start, uint16_t Height);
+void ILI9341_Scroll(uint16_t Offset);
+void ILI9341_Scroll_Off(void);
 void ILI9341_Fill_Screen(uint16_t Colour);
 void ILI9341_Draw_Colour(uint16_t Colour);
 void ILI9341_Draw_Pixel(uint16_t X,uint16_t Y,uint16_t Colour);
+void ILI9341_Draw_Pixels(uint16_t X, uint16_t Y, uint16_t Width, uint16_t Height, const uint16_t* Colours);
 void ILI9341_Draw_Colour_Burst(uint16_t Colour, uint32_t Size);
 
+uint8_t ILI9341_Is_Busy(void);
+void ILI9341_Wait_Idle(void);
+uint16_t* ILI9341_Get_Tx_Buffer(void);
+void ILI9341_Send_Tx_Buffer(uint16_t* Buffer, uint16_t Size, uint32_t Repeat, uint16_t Remainder);
+void ILI9341_Send_Const(const unsigned char* Data, uint32_t Size);
+void ILI9341_Send_Const_Pixels(const uint16_t* Colours, uint32_t Size);
+
+//USED BY THE DISPLAY LIST (ILI9341_Queue) WHILE NO TRANSFER IS RUNNING, SEE ILI9341_Transport.h
+void ILI9341_Direct_Window(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2);
+void ILI9341_Direct_Fill(uint16_t Colour, uint32_t Size);
+void ILI9341_Direct_Pixels(const uint16_t* Colours, uint32_t Size);
+uint16_t* ILI9341_Direct_Buffer(void);
+void ILI9341_Start_Queue(void);
+
 
 void ILI9341_Draw_Rectangle(uint16_t X, uint16_t Y, uint16_t Width, uint16_t Height, uint16_t Colour);
 void ILI9341_Draw_Horizontal_Line(uint16_t X, uint16_t Y, uint16_t Width, uint16_t Colour);
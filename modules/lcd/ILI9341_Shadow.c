@@ -0,0 +1,404 @@
+//-----------------------------------
+//	ILI9341 tile shadow (retained mode)
+//-----------------------------------
+//
+//	See ILI9341_Shadow.h. Slot_Of_Tile maps each tile of the screen to its buffer in the pool, a buffer holds
+//	the RGB565 colours of its tile row by row and one mask bit per drawn pixel.
+//
+//	A tile that was cleared and redrawn with the same content inside one frame is drawn but unchanged.
+//	Every tile keeps a hash of the pixels and mask last sent, the flush drops tiles whose hash still matches.
+//	The flush copies the pixels into buffers of its own, so a full pool can be flushed in the middle of a
+//	drawing call that is still reading one of the driver's transmit buffers.
+//
+//-----------------------------------
+
+#include <lcd/ILI9341_Shadow.h>
+#include <lcd/ILI9341_STM32_Driver.h>
+#include <lcd/ILI9341_Transport.h>
+#include <lcd/ILI9341_Queue.h>
+#include <string.h>
+
+#if ILI9341_SHADOW_ENABLE
+
+#if (ILI9341_SHADOW_TILES < 1) || (ILI9341_SHADOW_TILES > 254)
+#error "ILI9341_SHADOW_TILES must be 1 to 254"
+#endif
+
+#define SHADOW_TILE_PIXELS	(SHADOW_TILE_SIZE*SHADOW_TILE_SIZE)
+#define SHADOW_SCREEN_TILES	((ILI9341_SCREEN_WIDTH/SHADOW_TILE_SIZE)*(ILI9341_SCREEN_HEIGHT/SHADOW_TILE_SIZE))
+#define SHADOW_NO_SLOT		0xFF
+
+//RECTANGLES THE FLUSH KEEPS OPEN WHILE IT LOOKS FOR THE SAME RUN IN THE NEXT ROW
+#define SHADOW_OPEN_RECTS	16
+
+typedef struct
+{
+	uint16_t Pixels[SHADOW_TILE_PIXELS];
+	uint16_t Drawn[SHADOW_TILE_SIZE];		//ONE BIT PER PIXEL, BIT k = COLUMN k OF THE ROW
+	uint16_t Tile;
+} Shadow_Slot;
+
+typedef struct
+{
+	uint16_t X1, X2, Y1, Y2;
+} Shadow_Rect;
+
+uint8_t ILI9341_Shadow_Active = 0;
+uint16_t ILI9341_Shadow_Pool_Flushes = 0;
+
+static Shadow_Slot Pool[ILI9341_SHADOW_TILES];
+static uint8_t Slot_Of_Tile[SHADOW_SCREEN_TILES];
+static uint8_t Slots_Used = 0;
+static uint8_t Pool_Ready = 0;
+
+static uint32_t Tile_Hash[SHADOW_SCREEN_TILES];
+static uint32_t Hash_Valid[(SHADOW_SCREEN_TILES+31)/32];
+
+static uint16_t Flush_Buffer[2][BURST_MAX_PIXELS];
+static uint8_t Flush_Buffer_Next = 0;
+
+//ADDRESS WINDOW AND WRITE POSITION, SAME AUTO INCREMENT AS THE PANEL
+static uint16_t Win_X1, Win_Y1, Win_X2, Win_Y2;
+static uint16_t Cursor_X, Cursor_Y;
+
+//HIGH BYTE OF A PIXEL THAT WAS SPLIT BETWEEN TWO WRITES
+static uint8_t Pending_Byte;
+static uint8_t Pending_Valid = 0;
+
+static uint16_t ILI9341_Shadow_Tiles_X(void)
+{
+	return LCD_WIDTH/SHADOW_TILE_SIZE;
+}
+
+/*Returns the buffer of the tile at X,Y, or 0 if nothing has been drawn into the tile since the last flush*/
+static Shadow_Slot* ILI9341_Shadow_Find(uint16_t X, uint16_t Y)
+{
+	uint8_t Slot = Slot_Of_Tile[(Y/SHADOW_TILE_SIZE)*ILI9341_Shadow_Tiles_X() + X/SHADOW_TILE_SIZE];
+	return (Slot == SHADOW_NO_SLOT) ? 0 : &Pool[Slot];
+}
+
+/*Returns the buffer of the tile at X,Y and takes one from the pool for a tile drawn the first time, a full pool is flushed first*/
+static Shadow_Slot* ILI9341_Shadow_Get(uint16_t X, uint16_t Y)
+{
+	uint16_t Tile = (Y/SHADOW_TILE_SIZE)*ILI9341_Shadow_Tiles_X() + X/SHADOW_TILE_SIZE;
+
+	if(Slot_Of_Tile[Tile] != SHADOW_NO_SLOT) return &Pool[Slot_Of_Tile[Tile]];
+
+	if(Slots_Used == ILI9341_SHADOW_TILES)
+	{
+		ILI9341_Shadow_Pool_Flushes++;
+		ILI9341_Shadow_Flush();
+	}
+
+	Shadow_Slot* Slot = &Pool[Slots_Used];
+	Slot->Tile = Tile;
+	memset(Slot->Drawn, 0, sizeof(Slot->Drawn));
+	Slot_Of_Tile[Tile] = Slots_Used++;
+	return Slot;
+}
+
+/*FNV-1a hash over the mask and the drawn pixels of one tile*/
+static uint32_t ILI9341_Shadow_Hash(const Shadow_Slot* Slot)
+{
+	uint32_t Hash = 2166136261UL;
+
+	for(uint16_t j = 0; j < SHADOW_TILE_SIZE; j++)
+	{
+		uint16_t Drawn = Slot->Drawn[j];
+		Hash = (Hash ^ Drawn) * 16777619UL;
+		for(uint16_t k = 0; Drawn; k++, Drawn >>= 1)
+		{
+			if(Drawn & 1) Hash = (Hash ^ Slot->Pixels[j*SHADOW_TILE_SIZE + k]) * 16777619UL;
+		}
+	}
+	return Hash;
+}
+
+/*Moves the write position on by Count pixels within the current row of the window*/
+static void ILI9341_Shadow_Advance(uint16_t Count)
+{
+	Cursor_X += Count;
+	if(Cursor_X > Win_X2)
+	{
+		Cursor_X = Win_X1;
+		if(++Cursor_Y > Win_Y2) Cursor_Y = Win_Y1;
+	}
+}
+
+/*Stores Count pixels from the write position on, Count must not leave the current row*/
+/*Without Colours the pixels all get Colour, otherwise the next Count entries of Colours*/
+static void ILI9341_Shadow_Put(const uint16_t* Colours, uint16_t Colour, uint16_t Count)
+{
+	uint16_t X = Cursor_X;
+	uint16_t Y = Cursor_Y;
+	uint16_t End = Cursor_X + Count;
+
+	ILI9341_Shadow_Advance(Count);
+
+	if(Y >= LCD_HEIGHT) return;
+	if(End > LCD_WIDTH) End = LCD_WIDTH;
+
+	//ONE PIECE PER TILE THE RUN CROSSES
+	while(X < End)
+	{
+		uint16_t Tile_End = (X/SHADOW_TILE_SIZE + 1)*SHADOW_TILE_SIZE;
+		if(Tile_End > End) Tile_End = End;
+
+		Shadow_Slot* Slot = ILI9341_Shadow_Get(X, Y);
+		uint16_t Column = X%SHADOW_TILE_SIZE;
+		uint16_t Length = Tile_End - X;
+		uint16_t* Pixel = &Slot->Pixels[(Y%SHADOW_TILE_SIZE)*SHADOW_TILE_SIZE + Column];
+
+		Slot->Drawn[Y%SHADOW_TILE_SIZE] |= (uint16_t)(((1UL << Length) - 1) << Column);
+		if(Colours)
+		{
+			memcpy(Pixel, Colours, Length*sizeof(uint16_t));
+			Colours += Length;
+		}
+		else
+		{
+			for(uint16_t i = 0; i < Length; i++) Pixel[i] = Colour;
+		}
+		X = Tile_End;
+	}
+}
+
+/*Redirects all following drawing calls into the shadow*/
+void ILI9341_Shadow_Begin(void)
+{
+	//QUEUED COMMANDS WOULD BYPASS THE SHADOW
+	ILI9341_Queue_End();
+
+	if(!Pool_Ready)
+	{
+		memset(Slot_Of_Tile, SHADOW_NO_SLOT, sizeof(Slot_Of_Tile));
+		Pool_Ready = 1;
+	}
+	//THE PANEL MAY HAVE BEEN DRAWN DIRECTLY SINCE THE LAST FLUSH
+	ILI9341_Shadow_Invalidate();
+	ILI9341_Shadow_Active = 1;
+}
+
+/*Drawing calls go straight to the panel again, tiles not flushed yet stay in the pool*/
+void ILI9341_Shadow_End(void)
+{
+	ILI9341_Shadow_Active = 0;
+}
+
+/*Forgets what was sent, the next flush sends every drawn tile even if it did not change*/
+void ILI9341_Shadow_Invalidate(void)
+{
+	memset(Hash_Valid, 0, sizeof(Hash_Valid));
+}
+
+void ILI9341_Shadow_Window(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2)
+{
+	Win_X1 = X1;
+	Win_Y1 = Y1;
+	Win_X2 = X2;
+	Win_Y2 = Y2;
+	Cursor_X = X1;
+	Cursor_Y = Y1;
+	Pending_Valid = 0;
+}
+
+void ILI9341_Shadow_Fill(uint16_t Colour, uint32_t Size)
+{
+	while(Size)
+	{
+		uint32_t Run = Win_X2 - Cursor_X + 1;
+		if(Run > Size) Run = Size;
+
+		ILI9341_Shadow_Put(0, Colour, Run);
+		Size -= Run;
+	}
+}
+
+void ILI9341_Shadow_Write(const unsigned char* Buffer, uint16_t Size, uint32_t Repeat, uint16_t Remainder)
+{
+	//SAME BYTE SEQUENCE THE DMA JOB WOULD HAVE SENT
+	for(uint32_t r = 0; r <= Repeat; r++)
+	{
+		uint16_t Count = (r < Repeat) ? Size : Remainder;
+		for(uint16_t i = 0; i < Count; i++)
+		{
+			if(!Pending_Valid)
+			{
+				Pending_Byte = Buffer[i];
+				Pending_Valid = 1;
+			}
+			else
+			{
+				ILI9341_Shadow_Put(0, (Pending_Byte << 8) | Buffer[i], 1);
+				Pending_Valid = 0;
+			}
+		}
+	}
+}
+
+void ILI9341_Shadow_Write_Pixels(const uint16_t* Buffer, uint16_t Size, uint32_t Repeat, uint16_t Remainder)
+{
+	for(uint32_t r = 0; r <= Repeat; r++)
+	{
+		const uint16_t* Colours = Buffer;
+		uint16_t Count = (r < Repeat) ? Size : Remainder;
+
+		//ONE PIECE PER ROW OF THE WINDOW THE PIXELS SPAN
+		while(Count)
+		{
+			uint16_t Run = Win_X2 - Cursor_X + 1;
+			if(Run > Count) Run = Count;
+
+			ILI9341_Shadow_Put(Colours, 0, Run);
+			Colours += Run;
+			Count -= Run;
+		}
+	}
+}
+
+/*Sends one rectangle of drawn pixels to the panel*/
+static void ILI9341_Shadow_Send_Rect(const Shadow_Rect* Rect)
+{
+	ILI9341_Set_Address(Rect->X1, Rect->Y1, Rect->X2, Rect->Y2);
+
+	uint16_t X = Rect->X1;
+	uint16_t Y = Rect->Y1;
+	while(Y <= Rect->Y2)
+	{
+		uint16_t* Buffer = Flush_Buffer[Flush_Buffer_Next];
+		uint16_t Buffer_Counter = 0;
+		Flush_Buffer_Next ^= 1;
+
+		//FILL ONE BUFFER WHILE THE OTHER ONE IS SENT
+		while(ILI9341_Get_Transport()->Reading(Buffer)) ILI9341_WAIT_HOOK();
+		while((Buffer_Counter < BURST_MAX_PIXELS) && (Y <= Rect->Y2))
+		{
+			const Shadow_Slot* Slot = ILI9341_Shadow_Find(X, Y);
+			Buffer[Buffer_Counter++] = Slot->Pixels[(Y%SHADOW_TILE_SIZE)*SHADOW_TILE_SIZE + X%SHADOW_TILE_SIZE];
+
+			if(++X > Rect->X2)
+			{
+				X = Rect->X1;
+				Y++;
+			}
+		}
+		ILI9341_Send_Const_Pixels(Buffer, Buffer_Counter);
+	}
+}
+
+/*Sends all drawn pixels to the panel and empties the pool*/
+/*Each row is split into runs of drawn pixels; a run continues the rectangle of the same run in the row above*/
+void ILI9341_Shadow_Flush(void)
+{
+	if(Slots_Used == 0) return;
+
+	uint8_t Active = ILI9341_Shadow_Active;
+	uint16_t Tiles_X = ILI9341_Shadow_Tiles_X();
+	uint16_t Row_Drawn[ILI9341_SCREEN_WIDTH/SHADOW_TILE_SIZE];
+	Shadow_Rect Open[SHADOW_OPEN_RECTS];
+	uint8_t Open_Count = 0;
+
+	ILI9341_Shadow_Active = 0;
+
+	//DROP TILES THAT END UP WITH THE CONTENT THE PANEL ALREADY SHOWS
+	for(uint8_t i = 0; i < Slots_Used; i++)
+	{
+		uint16_t Tile = Pool[i].Tile;
+		uint32_t Hash = ILI9341_Shadow_Hash(&Pool[i]);
+
+		if(((Hash_Valid[Tile>>5] >> (Tile&31)) & 1) && (Hash == Tile_Hash[Tile]))
+		{
+			Slot_Of_Tile[Tile] = SHADOW_NO_SLOT;
+			continue;
+		}
+		Tile_Hash[Tile] = Hash;
+		Hash_Valid[Tile>>5] |= 1UL<<(Tile&31);
+	}
+
+	for(uint16_t Y = 0; Y < LCD_HEIGHT; Y++)
+	{
+		//MASK OF THE DRAWN PIXELS OF THE WHOLE ROW
+		const uint8_t* Row_Slots = &Slot_Of_Tile[(Y/SHADOW_TILE_SIZE)*Tiles_X];
+		for(uint16_t Tx = 0; Tx < Tiles_X; Tx++)
+		{
+			Row_Drawn[Tx] = (Row_Slots[Tx] == SHADOW_NO_SLOT) ? 0 : Pool[Row_Slots[Tx]].Drawn[Y%SHADOW_TILE_SIZE];
+		}
+
+		//RECTANGLES [0, Kept) GO ON IN THIS ROW, [Kept, Open_Count) ARE STILL WAITING FOR THEIR RUN
+		uint8_t Kept = 0;
+		uint16_t X = 0;
+		while(X < LCD_WIDTH)
+		{
+			if((Row_Drawn[X/SHADOW_TILE_SIZE] >> (X%SHADOW_TILE_SIZE)) == 0)
+			{
+				X = (X/SHADOW_TILE_SIZE + 1)*SHADOW_TILE_SIZE;
+				continue;
+			}
+			if(!((Row_Drawn[X/SHADOW_TILE_SIZE] >> (X%SHADOW_TILE_SIZE)) & 1))
+			{
+				X++;
+				continue;
+			}
+
+			Shadow_Rect Run;
+			Run.X1 = X;
+			while((X < LCD_WIDTH) && ((Row_Drawn[X/SHADOW_TILE_SIZE] >> (X%SHADOW_TILE_SIZE)) & 1)) X++;
+			Run.X2 = X-1;
+			Run.Y1 = Y;
+			Run.Y2 = Y;
+
+			uint8_t k;
+			for(k = Kept; k < Open_Count; k++)
+			{
+				if((Open[k].X1 == Run.X1) && (Open[k].X2 == Run.X2)) break;
+			}
+			if(k < Open_Count)
+			{
+				//SAME RUN AS IN THE ROW ABOVE, THE RECTANGLE GROWS BY ONE ROW
+				Run = Open[k];
+				Run.Y2 = Y;
+				Open[k] = Open[Kept];
+			}
+			else if(Open_Count < SHADOW_OPEN_RECTS)
+			{
+				Open[Open_Count++] = Open[Kept];
+			}
+			else if(Kept < Open_Count)
+			{
+				//NO ROOM, A RECTANGLE OF THE ROW ABOVE THAT HAS NOT GONE ON YET IS SENT
+				ILI9341_Shadow_Send_Rect(&Open[Open_Count-1]);
+				Open[Open_Count-1] = Open[Kept];
+			}
+			else
+			{
+				//NO ROOM, ALL OF THEM GO ON IN THIS ROW: THE LAST ONE ENDS HERE
+				ILI9341_Shadow_Send_Rect(&Open[--Kept]);
+			}
+			Open[Kept++] = Run;
+		}
+
+		//RECTANGLES WHOSE RUN DID NOT COME BACK IN THIS ROW ARE DONE
+		for(uint8_t k = Kept; k < Open_Count; k++) ILI9341_Shadow_Send_Rect(&Open[k]);
+		Open_Count = Kept;
+	}
+	for(uint8_t k = 0; k < Open_Count; k++) ILI9341_Shadow_Send_Rect(&Open[k]);
+
+	//THE POOL IS EMPTY AGAIN
+	for(uint8_t i = 0; i < Slots_Used; i++) Slot_Of_Tile[Pool[i].Tile] = SHADOW_NO_SLOT;
+	Slots_Used = 0;
+
+	ILI9341_Shadow_Active = Active;
+}
+
+#else
+
+void ILI9341_Shadow_Begin(void) {}
+void ILI9341_Shadow_End(void) {}
+void ILI9341_Shadow_Flush(void) {}
+void ILI9341_Shadow_Invalidate(void) {}
+void ILI9341_Shadow_Window(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2) {}
+void ILI9341_Shadow_Fill(uint16_t Colour, uint32_t Size) {}
+void ILI9341_Shadow_Write(const unsigned char* Buffer, uint16_t Size, uint32_t Repeat, uint16_t Remainder) {}
+void ILI9341_Shadow_Write_Pixels(const uint16_t* Buffer, uint16_t Size, uint32_t Repeat, uint16_t Remainder) {}
+
+#endif
@@ -0,0 +1,60 @@
+//-----------------------------------
+//	ILI9341 tile shadow (retained mode)
+//-----------------------------------
+//
+//	While the shadow is active the drawing calls of ILI9341_STM32_Driver and ILI9341_GFX do not touch the
+//	panel. The screen is split into SHADOW_TILE_SIZE x SHADOW_TILE_SIZE tiles; the first drawing call that
+//	touches a tile takes a tile buffer from a fixed pool of ILI9341_SHADOW_TILES and every pixel drawn into
+//	the tile is kept there, together with a mask of the pixels drawn. ILI9341_Shadow_Flush() then sends the
+//	drawn pixels of all tiles, merged into as few rectangles as possible, and gives the tile buffers back.
+//	Overdraw inside one frame (clear, then redraw the same widget) costs RAM writes only, and a tile that
+//	ends up exactly as it was last sent is not sent again.
+//
+//	A tile buffer takes 512 bytes of pixels and 32 bytes of mask, the default pool of 64 tiles about 35 KB.
+//	When a frame touches more tiles than the pool holds, the shadow flushes what it has and carries on with
+//	an empty pool; the frame is still correct but the panel may show its first part early. Size the pool for
+//	the tiles one frame of the application touches, ILI9341_Shadow_Pool_Flushes counts the overflows.
+//
+//	The shadow is only compiled in when ILI9341_SHADOW_ENABLE is defined as 1 (project settings -> Define
+//	symbols). Otherwise the functions are empty and every drawing call goes straight to the panel.
+//
+//	Pixels that are not drawn while the shadow is active keep what the panel shows, so the shadow can be
+//	started on a screen that was drawn directly. Set the rotation before the shadow is used.
+//
+//-----------------------------------
+
+#ifndef ILI9341_SHADOW_H
+#define ILI9341_SHADOW_H
+
+#include "stm32f4xx_hal.h"
+
+#ifndef ILI9341_SHADOW_ENABLE
+#define ILI9341_SHADOW_ENABLE		0
+#endif
+
+//TILE BUFFERS IN THE POOL, AT MOST 254
+#ifndef ILI9341_SHADOW_TILES
+#define ILI9341_SHADOW_TILES		64
+#endif
+
+#define SHADOW_TILE_SIZE				16
+
+#if ILI9341_SHADOW_ENABLE
+extern uint8_t ILI9341_Shadow_Active;
+extern uint16_t ILI9341_Shadow_Pool_Flushes;
+#else
+#define ILI9341_Shadow_Active		0
+#endif
+
+void ILI9341_Shadow_Begin(void);
+void ILI9341_Shadow_End(void);
+void ILI9341_Shadow_Flush(void);
+void ILI9341_Shadow_Invalidate(void);
+
+//CALLED BY THE DRIVER WHILE THE SHADOW IS ACTIVE
+void ILI9341_Shadow_Window(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2);
+void ILI9341_Shadow_Fill(uint16_t Colour, uint32_t Size);
+void ILI9341_Shadow_Write(const unsigned char* Buffer, uint16_t Size, uint32_t Repeat, uint16_t Remainder);
+void ILI9341_Shadow_Write_Pixels(const uint16_t* Buffer, uint16_t Size, uint32_t Repeat, uint16_t Remainder);
+
+#endif
@@ -0,0 +1,468 @@
+//-----------------------------------
+//	ILI9341 clipped primitives
+//-----------------------------------
+//
+//	See ILI9341_Shapes.h. Everything ends in ILI9341_Draw_HSpan, ILI9341_Draw_VSpan or ILI9341_Draw_Box,
+//	which clip and hand the rest to the span API of the driver.
+//
+//-----------------------------------
+
+#include <lcd/ILI9341_Shapes.h>
+#include <lcd/ILI9341_STM32_Driver.h>
+
+//OUTCODES OF COHEN-SUTHERLAND
+#define CLIP_LEFT		0x01
+#define CLIP_RIGHT		0x02
+#define CLIP_TOP		0x04
+#define CLIP_BOTTOM		0x08
+
+//CLIP RECTANGLE, INCLUSIVE. THE SCREEN LIMITS ARE APPLIED ON TOP, THEY CHANGE WITH THE ROTATION
+static int16_t Clip_X0 = 0;
+static int16_t Clip_Y0 = 0;
+static int16_t Clip_X1 = INT16_MAX;
+static int16_t Clip_Y1 = INT16_MAX;
+
+typedef struct
+{
+	int32_t X0;
+	int32_t Y0;
+	int32_t X1;
+	int32_t Y1;
+} ILI9341_Clip_Bounds;
+
+/*Drawing of the shapes is limited to X0..X1, Y0..Y1 (inclusive) from now on*/
+void ILI9341_Set_Clip(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1)
+{
+	Clip_X0 = X0;
+	Clip_Y0 = Y0;
+	Clip_X1 = X1;
+	Clip_Y1 = Y1;
+}
+
+/*Shapes may use the whole screen again*/
+void ILI9341_Reset_Clip(void)
+{
+	ILI9341_Set_Clip(0, 0, INT16_MAX, INT16_MAX);
+}
+
+/*Clip rectangle within the screen, returns 0 if nothing is left*/
+static uint8_t ILI9341_Get_Clip(ILI9341_Clip_Bounds* Bounds)
+{
+	Bounds->X0 = (Clip_X0 < 0) ? 0 : Clip_X0;
+	Bounds->Y0 = (Clip_Y0 < 0) ? 0 : Clip_Y0;
+	Bounds->X1 = (Clip_X1 >= LCD_WIDTH) ? LCD_WIDTH-1 : Clip_X1;
+	Bounds->Y1 = (Clip_Y1 >= LCD_HEIGHT) ? LCD_HEIGHT-1 : Clip_Y1;
+	return (Bounds->X0 <= Bounds->X1) && (Bounds->Y0 <= Bounds->Y1);
+}
+
+/*Solid box with signed corner, clipped*/
+static void ILI9341_Fill_Clipped(int32_t X, int32_t Y, int32_t Width, int32_t Height, uint16_t Colour)
+{
+	ILI9341_Clip_Bounds Clip;
+
+	if((Width <= 0) || (Height <= 0) || !ILI9341_Get_Clip(&Clip)) return;
+
+	int32_t X1 = X+Width-1;
+	int32_t Y1 = Y+Height-1;
+	if(X < Clip.X0) X = Clip.X0;
+	if(Y < Clip.Y0) Y = Clip.Y0;
+	if(X1 > Clip.X1) X1 = Clip.X1;
+	if(Y1 > Clip.Y1) Y1 = Clip.Y1;
+	if((X > X1) || (Y > Y1)) return;
+
+	if(Y == Y1) ILI9341_Draw_Horizontal_Line(X, Y, X1-X+1, Colour);
+	else if(X == X1) ILI9341_Draw_Vertical_Line(X, Y, Y1-Y+1, Colour);
+	else ILI9341_Draw_Rectangle(X, Y, X1-X+1, Y1-Y+1, Colour);
+}
+
+/*Horizontal span of Width pixels starting at X,Y, clipped*/
+void ILI9341_Draw_HSpan(int16_t X, int16_t Y, int16_t Width, uint16_t Colour)
+{
+	ILI9341_Fill_Clipped(X, Y, Width, 1, Colour);
+}
+
+/*Vertical span of Height pixels starting at X,Y, clipped*/
+void ILI9341_Draw_VSpan(int16_t X, int16_t Y, int16_t Height, uint16_t Colour)
+{
+	ILI9341_Fill_Clipped(X, Y, 1, Height, Colour);
+}
+
+/*Solid box with its upper left corner at X,Y, clipped*/
+void ILI9341_Draw_Box(int16_t X, int16_t Y, int16_t Width, int16_t Height, uint16_t Colour)
+{
+	ILI9341_Fill_Clipped(X, Y, Width, Height, Colour);
+}
+
+static uint8_t ILI9341_Outcode(const ILI9341_Clip_Bounds* Clip, int32_t X, int32_t Y)
+{
+	uint8_t Code = 0;
+
+	if(X < Clip->X0) Code |= CLIP_LEFT;
+	else if(X > Clip->X1) Code |= CLIP_RIGHT;
+	if(Y < Clip->Y0) Code |= CLIP_TOP;
+	else if(Y > Clip->Y1) Code |= CLIP_BOTTOM;
+	return Code;
+}
+
+/*Ceiling of Numerator/Denominator for a positive Denominator*/
+static int64_t ILI9341_Ceil_Div(int64_t Numerator, int64_t Denominator)
+{
+	int64_t Quotient = Numerator/Denominator;
+
+	if((Quotient*Denominator) < Numerator) Quotient++;
+	return Quotient;
+}
+
+//DRAW A LINE FROM X0,Y0 TO X1,Y1, BOTH END POINTS INCLUDED
+//
+//Traced along its major axis U with the minor coordinate V(U) = V0 + floor((2*(U-U0)*dV + dU) / (2*dU)),
+//Bresenham's rounding. Pixels that share a row (flat lines) or a column (steep lines) go out as one span.
+//For a line that crosses the clip border the range of U that stays inside is solved from the same formula,
+//tracing starts right there with the matching error term
+//
+void ILI9341_Draw_Line(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, uint16_t Colour)
+{
+	ILI9341_Clip_Bounds Clip;
+
+	if(!ILI9341_Get_Clip(&Clip)) return;
+
+	uint8_t Code0 = ILI9341_Outcode(&Clip, X0, Y0);
+	uint8_t Code1 = ILI9341_Outcode(&Clip, X1, Y1);
+	if(Code0 & Code1) return;
+
+	if(X0 == X1)
+	{
+		ILI9341_Fill_Clipped(X0, (Y0 < Y1) ? Y0 : Y1, 1, ((Y0 < Y1) ? Y1-Y0 : Y0-Y1) + 1, Colour);
+		return;
+	}
+	if(Y0 == Y1)
+	{
+		ILI9341_Fill_Clipped((X0 < X1) ? X0 : X1, Y0, ((X0 < X1) ? X1-X0 : X0-X1) + 1, 1, Colour);
+		return;
+	}
+
+	//MAJOR AXIS U, MINOR AXIS V, BOTH COUNTING UPWARDS
+	uint8_t Steep = ((Y1 > Y0) ? Y1-Y0 : Y0-Y1) > ((X1 > X0) ? X1-X0 : X0-X1);
+	int32_t U0 = Steep ? Y0 : X0, V0 = Steep ? X0 : Y0;
+	int32_t U1 = Steep ? Y1 : X1, V1 = Steep ? X1 : Y1;
+	int32_t U_Min = Steep ? Clip.Y0 : Clip.X0, U_Max = Steep ? Clip.Y1 : Clip.X1;
+	int32_t V_Min = Steep ? Clip.X0 : Clip.Y0, V_Max = Steep ? Clip.X1 : Clip.Y1;
+
+	if(U0 > U1)
+	{
+		int32_t Swap = U0; U0 = U1; U1 = Swap;
+		Swap = V0; V0 = V1; V1 = Swap;
+	}
+	int32_t V_Sign = 1;
+	if(V1 < V0)
+	{
+		//MIRROR THE MINOR AXIS
+		int32_t Swap = V_Min;
+		V_Sign = -1;
+		V0 = -V0;
+		V1 = -V1;
+		V_Min = -V_Max;
+		V_Max = -Swap;
+	}
+
+	int32_t dU = U1-U0;
+	int32_t dV = V1-V0;
+	int32_t U_First = (U0 > U_Min) ? U0 : U_Min;
+	int32_t U_Last = (U1 < U_Max) ? U1 : U_Max;
+
+	//FIRST U WITH V(U) >= V_Min, LAST U WITH V(U) <= V_Max
+	if(V0 < V_Min)
+	{
+		int64_t U = U0 + ILI9341_Ceil_Div(2*(int64_t)dU*(V_Min-V0) - dU, 2*(int64_t)dV);
+		if(U > U_First) U_First = (U > U_Last) ? U_Last+1 : (int32_t)U;
+	}
+	if(V1 > V_Max)
+	{
+		int64_t U = U0 + ILI9341_Ceil_Div(2*(int64_t)dU*(V_Max-V0+1) - dU, 2*(int64_t)dV) - 1;
+		if(U < U_Last) U_Last = (U < U_First) ? U_First-1 : (int32_t)U;
+	}
+	if(U_First > U_Last) return;
+
+	int64_t Numerator = 2*(int64_t)(U_First-U0)*dV + dU;
+	int32_t V = V0 + (int32_t)(Numerator/(2*dU));
+	int32_t Error = (int32_t)(Numerator%(2*dU));
+	int32_t Run_Start = U_First;
+
+	for(int32_t U = U_First; U <= U_Last; U++)
+	{
+		Error += 2*dV;
+		if((Error < 2*dU) && (U < U_Last)) continue;
+
+		//V CHANGES AFTER U OR THE LINE ENDS: SEND THE RUN
+		if(Steep) ILI9341_Fill_Clipped(V_Sign*V, Run_Start, 1, U-Run_Start+1, Colour);
+		else ILI9341_Fill_Clipped(Run_Start, V_Sign*V, U-Run_Start+1, 1, Colour);
+
+		Error -= 2*dU;
+		V++;
+		Run_Start = U+1;
+	}
+}
+
+/*Draws lines from each point to the next one*/
+void ILI9341_Draw_Polyline(const ILI9341_Point* Points, uint16_t Count, uint16_t Colour)
+{
+	for(uint16_t i = 1; i < Count; i++)
+	{
+		ILI9341_Draw_Line(Points[i-1].X, Points[i-1].Y, Points[i].X, Points[i].Y, Colour);
+	}
+}
+
+/*Draws the three edges of a triangle*/
+void ILI9341_Draw_Hollow_Triangle(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, int16_t X2, int16_t Y2, uint16_t Colour)
+{
+	ILI9341_Draw_Line(X0, Y0, X1, Y1, Colour);
+	ILI9341_Draw_Line(X1, Y1, X2, Y2, Colour);
+	ILI9341_Draw_Line(X2, Y2, X0, Y0, Colour);
+}
+
+//EDGE OF A FILLED TRIANGLE, X = XA + floor((Y-YA)*dX/dY) ADVANCED ROW BY ROW WITHOUT DIVISION
+typedef struct
+{
+	int32_t X;
+	int32_t Step;				//floor(dX/dY)
+	int32_t Error;
+	int32_t Error_Step;			//dX - Step*dY, 0..dY-1
+	int32_t dY;
+} ILI9341_Edge;
+
+static int64_t ILI9341_Floor_Div(int64_t Numerator, int64_t Denominator)
+{
+	int64_t Quotient = Numerator/Denominator;
+
+	if((Quotient*Denominator) > Numerator) Quotient--;
+	return Quotient;
+}
+
+/*Edge from XA,YA to XB,YB (YB > YA) positioned on row Y*/
+static void ILI9341_Edge_Init(ILI9341_Edge* Edge, int32_t XA, int32_t YA, int32_t XB, int32_t YB, int32_t Y)
+{
+	int32_t dX = XB-XA;
+	int64_t Numerator = (int64_t)(Y-YA)*dX;
+	int64_t Offset = ILI9341_Floor_Div(Numerator, YB-YA);
+
+	Edge->dY = YB-YA;
+	Edge->Step = (int32_t)ILI9341_Floor_Div(dX, Edge->dY);
+	Edge->Error_Step = dX - Edge->Step*Edge->dY;
+	Edge->X = XA + (int32_t)Offset;
+	Edge->Error = (int32_t)(Numerator - Offset*Edge->dY);
+}
+
+static void ILI9341_Edge_Next(ILI9341_Edge* Edge)
+{
+	Edge->X += Edge->Step;
+	Edge->Error += Edge->Error_Step;
+	if(Edge->Error >= Edge->dY)
+	{
+		Edge->Error -= Edge->dY;
+		Edge->X++;
+	}
+}
+
+//DRAW A FILLED TRIANGLE
+//
+//One horizontal span per row between the long edge (top to bottom corner) and the two short ones,
+//only the rows inside the clip rectangle are visited
+//
+void ILI9341_Draw_Filled_Triangle(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, int16_t X2, int16_t Y2, uint16_t Colour)
+{
+	ILI9341_Clip_Bounds Clip;
+	int32_t XA = X0, YA = Y0, XB = X1, YB = Y1, XC = X2, YC = Y2, Swap;
+
+	if(!ILI9341_Get_Clip(&Clip)) return;
+
+	//SORT THE CORNERS BY Y: A ON TOP, C AT THE BOTTOM
+	if(YA > YB) { Swap = XA; XA = XB; XB = Swap; Swap = YA; YA = YB; YB = Swap; }
+	if(YB > YC) { Swap = XB; XB = XC; XC = Swap; Swap = YB; YB = YC; YC = Swap; }
+	if(YA > YB) { Swap = XA; XA = XB; XB = Swap; Swap = YA; YA = YB; YB = Swap; }
+
+	if((YC < Clip.Y0) || (YA > Clip.Y1)) return;
+
+	if(YA == YC)
+	{
+		//ALL ON ONE ROW
+		int32_t Left = XA, Right = XA;
+		if(XB < Left) Left = XB;
+		if(XC < Left) Left = XC;
+		if(XB > Right) Right = XB;
+		if(XC > Right) Right = XC;
+		ILI9341_Fill_Clipped(Left, YA, Right-Left+1, 1, Colour);
+		return;
+	}
+
+	int32_t Y = (YA > Clip.Y0) ? YA : Clip.Y0;
+	int32_t Y_Last = (YC < Clip.Y1) ? YC : Clip.Y1;
+	ILI9341_Edge Long, Short;
+
+	ILI9341_Edge_Init(&Long, XA, YA, XC, YC, Y);
+	if(Y < YB) ILI9341_Edge_Init(&Short, XA, YA, XB, YB, Y);
+	else ILI9341_Edge_Init(&Short, XB, YB, XC, YC, Y);
+
+	for(; Y <= Y_Last; Y++)
+	{
+		//THE SECOND SHORT EDGE TAKES OVER ON THE ROW OF THE MIDDLE CORNER
+		if((Y == YB) && (YB != YC)) ILI9341_Edge_Init(&Short, XB, YB, XC, YC, Y);
+
+		int32_t Left = (Long.X < Short.X) ? Long.X : Short.X;
+		int32_t Right = (Long.X < Short.X) ? Short.X : Long.X;
+		if(Y == YC)
+		{
+			//BOTTOM ROW, A FLAT BOTTOM EDGE ENDS AT BOTH LOWER CORNERS
+			Left = (XC < Left) ? XC : Left;
+			Right = (XC > Right) ? XC : Right;
+			if(YB == YC)
+			{
+				Left = (XB < Left) ? XB : Left;
+				Right = (XB > Right) ? XB : Right;
+			}
+		}
+		ILI9341_Fill_Clipped(Left, Y, Right-Left+1, 1, Colour);
+
+		ILI9341_Edge_Next(&Long);
+		ILI9341_Edge_Next(&Short);
+	}
+}
+
+//CIRCLE OUTLINE STRETCHED BETWEEN FOUR CENTRES
+//
+//Same midpoint circle as ILI9341_Draw_Hollow_Circle used before: points that share a column or row within
+//one octant are sent as one span. The straight edges between the centres close the outline
+//
+void ILI9341_Draw_Round_Outline(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, int16_t Radius, uint16_t Colour)
+{
+	int x = Radius-1;
+	int y = 0;
+	int dx = 1;
+	int dy = 1;
+	int err = dx - (Radius << 1);
+	int Run_Start = 0;
+
+	if(Radius <= 0) return;
+
+	while (x >= y)
+	{
+		int Run_X = x;
+		int Run_End = y;
+
+		if (err <= 0)
+		{
+			y++;
+			err += dy;
+			dy += 2;
+		}
+		if (err > 0)
+		{
+			x--;
+			dx += 2;
+			err += (-Radius << 1) + dx;
+		}
+
+		//EMIT THE RUN ONCE x MOVES ON OR THE OCTANT IS COMPLETE
+		if ((x != Run_X) || (x < y))
+		{
+			int Length = Run_End - Run_Start + 1;
+
+			ILI9341_Fill_Clipped(X1 + Run_X, Y1 + Run_Start, 1, Length, Colour);
+			ILI9341_Fill_Clipped(X0 - Run_X, Y1 + Run_Start, 1, Length, Colour);
+			ILI9341_Fill_Clipped(X1 + Run_X, Y0 - Run_End, 1, Length, Colour);
+			ILI9341_Fill_Clipped(X0 - Run_X, Y0 - Run_End, 1, Length, Colour);
+
+			ILI9341_Fill_Clipped(X1 + Run_Start, Y1 + Run_X, Length, 1, Colour);
+			ILI9341_Fill_Clipped(X0 - Run_End, Y1 + Run_X, Length, 1, Colour);
+			ILI9341_Fill_Clipped(X1 + Run_Start, Y0 - Run_X, Length, 1, Colour);
+			ILI9341_Fill_Clipped(X0 - Run_End, Y0 - Run_X, Length, 1, Colour);
+
+			Run_Start = y;
+		}
+	}
+
+	//STRAIGHT EDGES, EMPTY FOR A CIRCLE
+	ILI9341_Fill_Clipped(X0 + 1, Y0 - (Radius-1), X1 - X0 - 1, 1, Colour);
+	ILI9341_Fill_Clipped(X0 + 1, Y1 + (Radius-1), X1 - X0 - 1, 1, Colour);
+	ILI9341_Fill_Clipped(X0 - (Radius-1), Y0 + 1, 1, Y1 - Y0 - 1, Colour);
+	ILI9341_Fill_Clipped(X1 + (Radius-1), Y0 + 1, 1, Y1 - Y0 - 1, Colour);
+}
+
+//DISC STRETCHED BETWEEN FOUR CENTRES
+//
+//Same rows as ILI9341_Draw_Filled_Circle used before: each row is sent once as a horizontal span,
+//the rows between Y0 and Y1 as one box
+//
+void ILI9341_Draw_Round_Fill(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, int16_t Radius, uint16_t Colour)
+{
+	int x = Radius;
+	int y = 0;
+	int xChange = 1 - (Radius << 1);
+	int yChange = 0;
+	int radiusError = 0;
+	int Stretch = X1 - X0;
+
+	if(Radius < 0) return;
+
+	while (x >= y)
+	{
+		int Row_X = x;
+		int Row_Y = y;
+
+		ILI9341_Fill_Clipped(X0 - x, Y1 + y, Stretch + 2*x + 1, 1, Colour);
+		if ((y != 0) || (Y0 != Y1))
+		{
+			ILI9341_Fill_Clipped(X0 - x, Y0 - y, Stretch + 2*x + 1, 1, Colour);
+		}
+
+		y++;
+		radiusError += yChange;
+		yChange += 2;
+		if (((radiusError << 1) + xChange) > 0)
+		{
+			x--;
+			radiusError += xChange;
+			xChange += 2;
+		}
+
+		//ROWS Y+-x ONLY GROW WHILE x STAYS THE SAME, SO THEY ARE SENT ONCE AT THEIR WIDEST
+		if ((x != Row_X) || (x < y))
+		{
+			if (Row_X != Row_Y)
+			{
+				ILI9341_Fill_Clipped(X0 - Row_Y, Y1 + Row_X, Stretch + 2*Row_Y + 1, 1, Colour);
+				ILI9341_Fill_Clipped(X0 - Row_Y, Y0 - Row_X, Stretch + 2*Row_Y + 1, 1, Colour);
+			}
+		}
+	}
+
+	ILI9341_Fill_Clipped(X0 - Radius, Y0 + 1, Stretch + 2*Radius + 1, Y1 - Y0 - 1, Colour);
+}
+
+/*Largest corner radius that fits into a Width x Height box*/
+static int16_t ILI9341_Fit_Radius(int16_t Width, int16_t Height, int16_t Radius)
+{
+	int16_t Limit = ((Width < Height) ? Width : Height) / 2;
+
+	if(Radius > Limit) Radius = Limit;
+	return (Radius < 1) ? 1 : Radius;
+}
+
+/*Outline of a Width x Height box at X,Y with corners of the given radius*/
+void ILI9341_Draw_Hollow_Round_Rectangle(int16_t X, int16_t Y, int16_t Width, int16_t Height, int16_t Radius, uint16_t Colour)
+{
+	if((Width <= 0) || (Height <= 0)) return;
+
+	//THE OUTLINE OF RADIUS R LIES R-1 AWAY FROM ITS CENTRES
+	Radius = ILI9341_Fit_Radius(Width, Height, Radius);
+	ILI9341_Draw_Round_Outline(X + Radius-1, Y + Radius-1, X + Width - Radius, Y + Height - Radius, Radius, Colour);
+}
+
+/*Filled Width x Height box at X,Y with corners of the given radius*/
+void ILI9341_Draw_Filled_Round_Rectangle(int16_t X, int16_t Y, int16_t Width, int16_t Height, int16_t Radius, uint16_t Colour)
+{
+	if((Width <= 0) || (Height <= 0)) return;
+
+	//THE DISC OF RADIUS R REACHES R AWAY FROM ITS CENTRES
+	Radius = ILI9341_Fit_Radius(Width, Height, Radius) - 1;
+	ILI9341_Draw_Round_Fill(X + Radius, Y + Radius, X + Width-1 - Radius, Y + Height-1 - Radius, Radius, Colour);
+}
@@ -0,0 +1,51 @@
+//-----------------------------------
+//	ILI9341 clipped primitives
+//-----------------------------------
+//
+//	Lines, polylines, triangles, rounded rectangles and the circles of ILI9341_GFX, drawn as horizontal and
+//	vertical spans instead of single pixels. A span costs one address window and one DMA fill however long
+//	it is, so a flat line or the edge of a filled shape goes out in a handful of transfers.
+//
+//	All coordinates are signed: shapes may reach past the screen edges or lie completely outside. Every span
+//	is clipped against the clip rectangle (ILI9341_Set_Clip, the whole screen by default) and the screen in
+//	signed arithmetic, nothing wraps around. Lines are clipped before they are traced: the Cohen-Sutherland
+//	outcodes of the end points reject lines outside and accept lines inside, for the others the visible part
+//	is worked out exactly on integers, so a clipped line has the same pixels as the unclipped one.
+//
+//	The clip rectangle only applies to the calls of this file and the circles, not to text, images or
+//	rectangles of the driver.
+//
+//-----------------------------------
+
+#ifndef ILI9341_SHAPES_H
+#define ILI9341_SHAPES_H
+
+#include "stm32f4xx_hal.h"
+
+typedef struct
+{
+	int16_t X;
+	int16_t Y;
+} ILI9341_Point;
+
+void ILI9341_Set_Clip(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1);
+void ILI9341_Reset_Clip(void);
+
+//SPANS AND BOXES, CLIPPED
+void ILI9341_Draw_HSpan(int16_t X, int16_t Y, int16_t Width, uint16_t Colour);
+void ILI9341_Draw_VSpan(int16_t X, int16_t Y, int16_t Height, uint16_t Colour);
+void ILI9341_Draw_Box(int16_t X, int16_t Y, int16_t Width, int16_t Height, uint16_t Colour);
+
+void ILI9341_Draw_Line(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, uint16_t Colour);
+void ILI9341_Draw_Polyline(const ILI9341_Point* Points, uint16_t Count, uint16_t Colour);
+void ILI9341_Draw_Hollow_Triangle(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, int16_t X2, int16_t Y2, uint16_t Colour);
+void ILI9341_Draw_Filled_Triangle(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, int16_t X2, int16_t Y2, uint16_t Colour);
+void ILI9341_Draw_Hollow_Round_Rectangle(int16_t X, int16_t Y, int16_t Width, int16_t Height, int16_t Radius, uint16_t Colour);
+void ILI9341_Draw_Filled_Round_Rectangle(int16_t X, int16_t Y, int16_t Width, int16_t Height, int16_t Radius, uint16_t Colour);
+
+//CIRCLE OUTLINE AND DISC STRETCHED BETWEEN FOUR CENTRES: THE LEFT QUARTERS AROUND X0, THE RIGHT ONES AROUND X1,
+//THE TOP ONES AROUND Y0, THE BOTTOM ONES AROUND Y1. X0 == X1 AND Y0 == Y1 GIVES A CIRCLE
+void ILI9341_Draw_Round_Outline(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, int16_t Radius, uint16_t Colour);
+void ILI9341_Draw_Round_Fill(int16_t X0, int16_t Y0, int16_t X1, int16_t Y1, int16_t Radius, uint16_t Colour);
+
+#endif
@@ -0,0 +1,71 @@
+//-----------------------------------
+//	ILI9341 transport
+//-----------------------------------
+//
+//	Everything the driver sends to the panel goes through one transport. Chip select, D/C, the SPI and the DMA
+//	live behind it; ILI9341_STM32_Driver, the display list and everything above them only see address windows,
+//	commands and pixels. The same drawing code can so be run and measured over each backend:
+//
+//	ILI9341_Transport_SPI_DMA		SPI5 with DMA2 Stream6, drawing calls return while the pixels are still on the wire,
+//									the display list runs in the transfer interrupt. The default
+//	ILI9341_Transport_SPI_Polling	SPI5 with HAL_SPI_Transmit, every call returns when its data is out. No interrupt and
+//									no DMA stream, the display list is worked off as soon as a command is queued
+//	ILI9341_Transport_Host			tools/lcd_host only, writes straight into the virtual panel without SPI5
+//
+//	A project chooses its transport with ILI9341_TRANSPORT in its symbols, e.g.
+//	ILI9341_TRANSPORT=ILI9341_Transport_SPI_Polling. ILI9341_Set_Transport() switches at run time, for benchmarks
+//	that draw the same screen over each of them.
+//
+//	Write_Pixels, Write_Bytes and Write_Repeat select the panel themselves and release it once their data is out.
+//	An asynchronous transport returns earlier and keeps reading Colours or Data, Reading() tells when a buffer may
+//	be written again. Begin_Window and Write_Command never wait: the driver only calls them while Busy() is 0,
+//	or from the display list, which the transport starts when nothing is on the wire.
+//
+//-----------------------------------
+
+#ifndef ILI9341_TRANSPORT_H
+#define ILI9341_TRANSPORT_H
+
+#include "stm32f4xx_hal.h"
+
+typedef struct
+{
+	//PINS AND PERIPHERALS, CALLED BY ILI9341_Init AND ILI9341_Set_Transport
+	void (*Init)(void);
+
+	//ONE COMMAND AND ITS PARAMETERS, THE PANEL STAYS SELECTED FOR MORE COMMANDS UNTIL End
+	void (*Write_Command)(uint8_t Command, const uint8_t* Parameters, uint16_t Count);
+
+	//COLUMN ADDRESS, PAGE ADDRESS AND MEMORY WRITE, THE PANEL STAYS SELECTED FOR THE PIXELS
+	void (*Begin_Window)(uint16_t X1, uint16_t Y1, uint16_t X2, uint16_t Y2);
+
+	//PIXEL DATA FOR THE OPEN WINDOW: NATIVE COLOURS, BYTES WITH THE HIGH BYTE FIRST, ONE COLOUR Size TIMES
+	void (*Write_Pixels)(const uint16_t* Colours, uint32_t Size);
+	void (*Write_Bytes)(const unsigned char* Data, uint32_t Size);
+	void (*Write_Repeat)(uint16_t Colour, uint32_t Size);
+
+	//RELEASES THE PANEL AFTER COMMANDS OR Begin_Window, AN ASYNCHRONOUS TRANSPORT ONCE ITS LAST TRANSFER IS DONE
+	void (*End)(void);
+
+	//STARTS THE DISPLAY LIST, SEE ILI9341_Queue_Next
+	void (*Run_Queue)(void);
+
+	//1 WHILE A TRANSFER IS RUNNING OR WAITING
+	uint8_t (*Busy)(void);
+
+	//1 WHILE A RUNNING OR WAITING TRANSFER STILL READS FROM Buffer
+	uint8_t (*Reading)(const void* Buffer);
+} ILI9341_Transport;
+
+extern const ILI9341_Transport ILI9341_Transport_SPI_DMA;
+extern const ILI9341_Transport ILI9341_Transport_SPI_Polling;
+
+//TRANSPORT ILI9341_Init STARTS WITH, DEFINE IT IN THE PROJECT'S SYMBOLS TO CHOOSE ANOTHER ONE
+#ifndef ILI9341_TRANSPORT
+#define ILI9341_TRANSPORT			ILI9341_Transport_SPI_DMA
+#endif
+
+void ILI9341_Set_Transport(const ILI9341_Transport* Transport);
+const ILI9341_Transport* ILI9341_Get_Transport(void);
+
+#endif
@@ -0,0 +1,209 @@
+/* Generated by tools/lcd_font from modules/lcd/5x5_font.h: size 2, fixed width, 1536 bytes of bitmaps, 0 kerning pairs */
+#include <lcd/ILI9341_Font.h>
+
+static const uint8_t ILI9341_Font_Fixed_2_bitmaps[] =
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xCC, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0xFF, 0xC0, 0x33, 0x00, 0xFF, 0xC0, 0x33, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0C, 0x00, 0xFF, 0xC0, 0xCC, 0x00, 0xFF, 0xC0, 0x0C, 0xC0, 0xFF, 0xC0, 0x0C, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xC0, 0x00, 0x3C, 0xC0, 0xC3, 0x00, 0x3C, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	0x30, 0x00, 0xFC, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0xFF, 0xC0, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC3, 0xC0, 0xCC, 0xC0, 0xF0, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xF0, 0x00, 0x30, 0x00, 0x30, 0x00, 0xFC, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xCC, 0x00, 0xFF, 0xC0, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xC3, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xC0, 0xCF, 0xC0, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0x00, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00, 0xFF, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00, 0xFF, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00, 0xC3, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC3, 0x00, 0xFC, 0x00, 0xC3, 0x00, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xF3, 0xC0, 0xCC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xF0, 0xC0, 0xCC, 0xC0, 0xC3, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xC0, 0xC0, 0xFF, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xC0, 0xC0, 0xFF, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x33, 0x00, 0x33, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0x33, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x33, 0x00, 0x0C, 0x00, 0x33, 0x00, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x33, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xF0, 0x00, 0x00, 0x00,
+	0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+	0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0x00, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00, 0xFF, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00, 0xFF, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00, 0xC3, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC3, 0x00, 0xFC, 0x00, 0xC3, 0x00, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xF3, 0xC0, 0xCC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xF0, 0xC0, 0xCC, 0xC0, 0xC3, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xC0, 0xC0, 0xFF, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xC0, 0xC0, 0xFF, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x33, 0x00, 0x33, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0x33, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x33, 0x00, 0x0C, 0x00, 0x33, 0x00, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x33, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x30, 0x00, 0xF0, 0x00, 0x30, 0x00, 0x3C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x30, 0x00, 0x3C, 0x00, 0x30, 0x00, 0xF0, 0x00, 0x00, 0x00,
+	0x33, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const ILI9341_Font_Glyph ILI9341_Font_Fixed_2_glyphs[] =
+{
+	{    0, 12, 12 },	/* ' ' */
+	{   16, 12, 12 },	/* '!' */
+	{   32, 12, 12 },	/* '"' */
+	{   48, 12, 12 },	/* '#' */
+	{   64, 12, 12 },	/* '$' */
+	{   80, 12, 12 },	/* '%' */
+	{   96, 12, 12 },	/* '&' */
+	{  112, 12, 12 },	/* ''' */
+	{  128, 12, 12 },	/* '(' */
+	{  144, 12, 12 },	/* ')' */
+	{  160, 12, 12 },	/* '*' */
+	{  176, 12, 12 },	/* '+' */
+	{  192, 12, 12 },	/* ',' */
+	{  208, 12, 12 },	/* '-' */
+	{  224, 12, 12 },	/* '.' */
+	{  240, 12, 12 },	/* '/' */
+	{  256, 12, 12 },	/* '0' */
+	{  272, 12, 12 },	/* '1' */
+	{  288, 12, 12 },	/* '2' */
+	{  304, 12, 12 },	/* '3' */
+	{  320, 12, 12 },	/* '4' */
+	{  336, 12, 12 },	/* '5' */
+	{  352, 12, 12 },	/* '6' */
+	{  368, 12, 12 },	/* '7' */
+	{  384, 12, 12 },	/* '8' */
+	{  400, 12, 12 },	/* '9' */
+	{  416, 12, 12 },	/* ':' */
+	{  432, 12, 12 },	/* ';' */
+	{  448, 12, 12 },	/* '<' */
+	{  464, 12, 12 },	/* '=' */
+	{  480, 12, 12 },	/* '>' */
+	{  496, 12, 12 },	/* '?' */
+	{  512, 12, 12 },	/* '@' */
+	{  528, 12, 12 },	/* 'A' */
+	{  544, 12, 12 },	/* 'B' */
+	{  560, 12, 12 },	/* 'C' */
+	{  576, 12, 12 },	/* 'D' */
+	{  592, 12, 12 },	/* 'E' */
+	{  608, 12, 12 },	/* 'F' */
+	{  624, 12, 12 },	/* 'G' */
+	{  640, 12, 12 },	/* 'H' */
+	{  656, 12, 12 },	/* 'I' */
+	{  672, 12, 12 },	/* 'J' */
+	{  688, 12, 12 },	/* 'K' */
+	{  704, 12, 12 },	/* 'L' */
+	{  720, 12, 12 },	/* 'M' */
+	{  736, 12, 12 },	/* 'N' */
+	{  752, 12, 12 },	/* 'O' */
+	{  768, 12, 12 },	/* 'P' */
+	{  784, 12, 12 },	/* 'Q' */
+	{  800, 12, 12 },	/* 'R' */
+	{  816, 12, 12 },	/* 'S' */
+	{  832, 12, 12 },	/* 'T' */
+	{  848, 12, 12 },	/* 'U' */
+	{  864, 12, 12 },	/* 'V' */
+	{  880, 12, 12 },	/* 'W' */
+	{  896, 12, 12 },	/* 'X' */
+	{  912, 12, 12 },	/* 'Y' */
+	{  928, 12, 12 },	/* 'Z' */
+	{  944, 12, 12 },	/* '[' */
+	{  960, 12, 12 },	/* '\' */
+	{  976, 12, 12 },	/* ']' */
+	{  992, 12, 12 },	/* '^' */
+	{ 1008, 12, 12 },	/* '_' */
+	{ 1024, 12, 12 },	/* '`' */
+	{ 1040, 12, 12 },	/* 'a' */
+	{ 1056, 12, 12 },	/* 'b' */
+	{ 1072, 12, 12 },	/* 'c' */
+	{ 1088, 12, 12 },	/* 'd' */
+	{ 1104, 12, 12 },	/* 'e' */
+	{ 1120, 12, 12 },	/* 'f' */
+	{ 1136, 12, 12 },	/* 'g' */
+	{ 1152, 12, 12 },	/* 'h' */
+	{ 1168, 12, 12 },	/* 'i' */
+	{ 1184, 12, 12 },	/* 'j' */
+	{ 1200, 12, 12 },	/* 'k' */
+	{ 1216, 12, 12 },	/* 'l' */
+	{ 1232, 12, 12 },	/* 'm' */
+	{ 1248, 12, 12 },	/* 'n' */
+	{ 1264, 12, 12 },	/* 'o' */
+	{ 1280, 12, 12 },	/* 'p' */
+	{ 1296, 12, 12 },	/* 'q' */
+	{ 1312, 12, 12 },	/* 'r' */
+	{ 1328, 12, 12 },	/* 's' */
+	{ 1344, 12, 12 },	/* 't' */
+	{ 1360, 12, 12 },	/* 'u' */
+	{ 1376, 12, 12 },	/* 'v' */
+	{ 1392, 12, 12 },	/* 'w' */
+	{ 1408, 12, 12 },	/* 'x' */
+	{ 1424, 12, 12 },	/* 'y' */
+	{ 1440, 12, 12 },	/* 'z' */
+	{ 1456, 12, 12 },	/* '{' */
+	{ 1472, 12, 12 },	/* '|' */
+	{ 1488, 12, 12 },	/* '}' */
+	{ 1504, 12, 12 },	/* '~' */
+	{ 1520, 12, 12 },	/* DEL */
+};
+
+const ILI9341_Font ILI9341_Font_Fixed_2 =
+{
+	16, 2, ' ', 96,
+	ILI9341_Font_Fixed_2_glyphs, ILI9341_Font_Fixed_2_bitmaps,
+	0, 0
+};
@@ -0,0 +1,257 @@
+/* Generated by tools/lcd_font from modules/lcd/5x5_font.h: size 3, fixed width, 2304 bytes of bitmaps, 0 kerning pairs */
+#include <lcd/ILI9341_Font.h>
+
+static const uint8_t ILI9341_Font_Fixed_3_bitmaps[] =
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00,
+	0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xE3, 0x80, 0x00, 0xE3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x70,
+	0x00, 0xFF, 0xFE, 0x00, 0x1C, 0x70, 0x00, 0xFF, 0xFE, 0x00, 0x1C, 0x70, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0xFF, 0xFE, 0x00, 0xE3, 0x80, 0x00, 0xFF, 0xFE, 0x00, 0x03,
+	0x8E, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E,
+	0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0xE0, 0x00, 0x00, 0x1F, 0x8E, 0x00, 0xE0,
+	0x70, 0x00, 0x1F, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0,
+	0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00,
+	0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1C, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+	0x00, 0x03, 0x80, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+	0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xE0, 0x7E, 0x00, 0xE3, 0x8E, 0x00, 0xFC,
+	0x0E, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00,
+	0x00, 0xFC, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0E, 0x00, 0x1F, 0xF0, 0x00, 0xE0,
+	0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+	0x00, 0x00, 0x0E, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x0E, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE3, 0x80, 0x00, 0xFF,
+	0xFE, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+	0x00, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x0E, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xE0,
+	0x0E, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+	0x00, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xFE, 0x00, 0xE0,
+	0x0E, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+	0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0E, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1C,
+	0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x1C,
+	0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
+	0x00, 0xE0, 0x70, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xE0, 0x0E, 0x00, 0xE3, 0xFE, 0x00, 0xE0,
+	0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+	0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xFE, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xF0, 0x00, 0xE0,
+	0x0E, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+	0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
+	0x0E, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+	0x00, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xE0,
+	0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+	0x00, 0xE0, 0x00, 0x00, 0xE0, 0x7E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xFE, 0x00, 0xE0,
+	0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+	0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0xE0,
+	0x0E, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E,
+	0x00, 0xE0, 0x70, 0x00, 0xFF, 0x80, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0,
+	0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E,
+	0x00, 0xFC, 0x7E, 0x00, 0xE3, 0x8E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0xFC, 0x0E, 0x00, 0xE3, 0x8E, 0x00, 0xE0,
+	0x7E, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
+	0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xF0, 0x00, 0xE0,
+	0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+	0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xF0, 0x00, 0xE0,
+	0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+	0x00, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0E, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
+	0x80, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E,
+	0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x1C, 0x70, 0x00, 0x1C,
+	0x70, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E,
+	0x00, 0xE0, 0x0E, 0x00, 0xE3, 0x8E, 0x00, 0xE3, 0x8E, 0x00, 0x1C, 0x70, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0x1C, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C,
+	0x70, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E,
+	0x00, 0xE0, 0x0E, 0x00, 0x1C, 0x70, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C,
+	0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
+	0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x03,
+	0x80, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
+	0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+	0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+	0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xFE, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xF0, 0x00, 0xE0,
+	0x0E, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+	0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
+	0x0E, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+	0x00, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0xE0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xE0,
+	0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+	0x00, 0xE0, 0x00, 0x00, 0xE0, 0x7E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xFE, 0x00, 0xE0,
+	0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+	0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0xE0,
+	0x0E, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E,
+	0x00, 0xE0, 0x70, 0x00, 0xFF, 0x80, 0x00, 0xE0, 0x70, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0,
+	0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E,
+	0x00, 0xFC, 0x7E, 0x00, 0xE3, 0x8E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0xFC, 0x0E, 0x00, 0xE3, 0x8E, 0x00, 0xE0,
+	0x7E, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0,
+	0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xF0, 0x00, 0xE0,
+	0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+	0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xF0, 0x00, 0xE0,
+	0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+	0x00, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x0E, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
+	0x80, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E,
+	0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x1C, 0x70, 0x00, 0x1C,
+	0x70, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E,
+	0x00, 0xE0, 0x0E, 0x00, 0xE3, 0x8E, 0x00, 0xE3, 0x8E, 0x00, 0x1C, 0x70, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0x1C, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C,
+	0x70, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E,
+	0x00, 0xE0, 0x0E, 0x00, 0x1C, 0x70, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x1C,
+	0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80,
+	0x00, 0x1C, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+	0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
+	0x00, 0x1C, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1C, 0x70, 0x00, 0xE3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const ILI9341_Font_Glyph ILI9341_Font_Fixed_3_glyphs[] =
+{
+	{    0, 18, 18 },	/* ' ' */
+	{   24, 18, 18 },	/* '!' */
+	{   48, 18, 18 },	/* '"' */
+	{   72, 18, 18 },	/* '#' */
+	{   96, 18, 18 },	/* '$' */
+	{  120, 18, 18 },	/* '%' */
+	{  144, 18, 18 },	/* '&' */
+	{  168, 18, 18 },	/* ''' */
+	{  192, 18, 18 },	/* '(' */
+	{  216, 18, 18 },	/* ')' */
+	{  240, 18, 18 },	/* '*' */
+	{  264, 18, 18 },	/* '+' */
+	{  288, 18, 18 },	/* ',' */
+	{  312, 18, 18 },	/* '-' */
+	{  336, 18, 18 },	/* '.' */
+	{  360, 18, 18 },	/* '/' */
+	{  384, 18, 18 },	/* '0' */
+	{  408, 18, 18 },	/* '1' */
+	{  432, 18, 18 },	/* '2' */
+	{  456, 18, 18 },	/* '3' */
+	{  480, 18, 18 },	/* '4' */
+	{  504, 18, 18 },	/* '5' */
+	{  528, 18, 18 },	/* '6' */
+	{  552, 18, 18 },	/* '7' */
+	{  576, 18, 18 },	/* '8' */
+	{  600, 18, 18 },	/* '9' */
+	{  624, 18, 18 },	/* ':' */
+	{  648, 18, 18 },	/* ';' */
+	{  672, 18, 18 },	/* '<' */
+	{  696, 18, 18 },	/* '=' */
+	{  720, 18, 18 },	/* '>' */
+	{  744, 18, 18 },	/* '?' */
+	{  768, 18, 18 },	/* '@' */
+	{  792, 18, 18 },	/* 'A' */
+	{  816, 18, 18 },	/* 'B' */
+	{  840, 18, 18 },	/* 'C' */
+	{  864, 18, 18 },	/* 'D' */
+	{  888, 18, 18 },	/* 'E' */
+	{  912, 18, 18 },	/* 'F' */
+	{  936, 18, 18 },	/* 'G' */
+	{  960, 18, 18 },	/* 'H' */
+	{  984, 18, 18 },	/* 'I' */
+	{ 1008, 18, 18 },	/* 'J' */
+	{ 1032, 18, 18 },	/* 'K' */
+	{ 1056, 18, 18 },	/* 'L' */
+	{ 1080, 18, 18 },	/* 'M' */
+	{ 1104, 18, 18 },	/* 'N' */
+	{ 1128, 18, 18 },	/* 'O' */
+	{ 1152, 18, 18 },	/* 'P' */
+	{ 1176, 18, 18 },	/* 'Q' */
+	{ 1200, 18, 18 },	/* 'R' */
+	{ 1224, 18, 18 },	/* 'S' */
+	{ 1248, 18, 18 },	/* 'T' */
+	{ 1272, 18, 18 },	/* 'U' */
+	{ 1296, 18, 18 },	/* 'V' */
+	{ 1320, 18, 18 },	/* 'W' */
+	{ 1344, 18, 18 },	/* 'X' */
+	{ 1368, 18, 18 },	/* 'Y' */
+	{ 1392, 18, 18 },	/* 'Z' */
+	{ 1416, 18, 18 },	/* '[' */
+	{ 1440, 18, 18 },	/* '\' */
+	{ 1464, 18, 18 },	/* ']' */
+	{ 1488, 18, 18 },	/* '^' */
+	{ 1512, 18, 18 },	/* '_' */
+	{ 1536, 18, 18 },	/* '`' */
+	{ 1560, 18, 18 },	/* 'a' */
+	{ 1584, 18, 18 },	/* 'b' */
+	{ 1608, 18, 18 },	/* 'c' */
+	{ 1632, 18, 18 },	/* 'd' */
+	{ 1656, 18, 18 },	/* 'e' */
+	{ 1680, 18, 18 },	/* 'f' */
+	{ 1704, 18, 18 },	/* 'g' */
+	{ 1728, 18, 18 },	/* 'h' */
+	{ 1752, 18, 18 },	/* 'i' */
+	{ 1776, 18, 18 },	/* 'j' */
+	{ 1800, 18, 18 },	/* 'k' */
+	{ 1824, 18, 18 },	/* 'l' */
+	{ 1848, 18, 18 },	/* 'm' */
+	{ 1872, 18, 18 },	/* 'n' */
+	{ 1896, 18, 18 },	/* 'o' */
+	{ 1920, 18, 18 },	/* 'p' */
+	{ 1944, 18, 18 },	/* 'q' */
+	{ 1968, 18, 18 },	/* 'r' */
+	{ 1992, 18, 18 },	/* 's' */
+	{ 2016, 18, 18 },	/* 't' */
+	{ 2040, 18, 18 },	/* 'u' */
+	{ 2064, 18, 18 },	/* 'v' */
+	{ 2088, 18, 18 },	/* 'w' */
+	{ 2112, 18, 18 },	/* 'x' */
+	{ 2136, 18, 18 },	/* 'y' */
+	{ 2160, 18, 18 },	/* 'z' */
+	{ 2184, 18, 18 },	/* '{' */
+	{ 2208, 18, 18 },	/* '|' */
+	{ 2232, 18, 18 },	/* '}' */
+	{ 2256, 18, 18 },	/* '~' */
+	{ 2280, 18, 18 },	/* DEL */
+};
+
+const ILI9341_Font ILI9341_Font_Fixed_3 =
+{
+	24, 3, ' ', 96,
+	ILI9341_Font_Fixed_3_glyphs, ILI9341_Font_Fixed_3_bitmaps,
+	0, 0
+};
@@ -0,0 +1,220 @@
+/* Generated by tools/lcd_font from modules/lcd/5x5_font.h: size 2, proportional, 1320 bytes of bitmaps, 118 kerning pairs */
+#include <lcd/ILI9341_Font.h>
+
+static const uint8_t ILI9341_Font_Prop_2_bitmaps[] =
+{
+	0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0xFF, 0xC0, 0x33, 0x00, 0xFF, 0xC0, 0x33, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0C, 0x00, 0xFF, 0xC0, 0xCC, 0x00, 0xFF, 0xC0, 0x0C, 0xC0, 0xFF, 0xC0, 0x0C, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xC0, 0x00, 0x3C, 0xC0, 0xC3, 0x00, 0x3C, 0xC0, 0x00, 0x00,
+	0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xC0, 0xC0, 0xC0, 0x30, 0x00,
+	0x00, 0x00, 0xC0, 0x30, 0x30, 0x30, 0xC0, 0x00, 0x30, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0xFF, 0xC0, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00,
+	0x00, 0x00, 0x0C, 0x0C, 0x30, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC3, 0xC0,
+	0xCC, 0xC0, 0xF0, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x3C, 0x00,
+	0x0C, 0x00, 0x0C, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xC0,
+	0x3F, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xC0,
+	0x3F, 0x00, 0x00, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+	0xCC, 0x00, 0xFF, 0xC0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00,
+	0xFF, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00,
+	0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xC0,
+	0x03, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xC0,
+	0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xC0,
+	0xFF, 0xC0, 0x00, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00,
+	0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x0C, 0x30, 0xC0, 0x30, 0x0C, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xC0, 0x30, 0x0C, 0x30, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0xC3, 0x0C, 0x00, 0x0C, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xC0, 0xCF, 0xC0, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xC0, 0xFF, 0x00, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00, 0xFF, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00, 0xFF, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00, 0xC3, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC3, 0x00, 0xFC, 0x00, 0xC3, 0x00, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xF3, 0xC0, 0xCC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xF0, 0xC0, 0xCC, 0xC0, 0xC3, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xC0, 0xC0, 0xFF, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xC0, 0xC0, 0xFF, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x33, 0x00, 0x33, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xCC, 0xC0, 0xCC, 0xC0, 0x33, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x33, 0x00, 0x0C, 0x00, 0x33, 0x00, 0xC0, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x33, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xFF, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0xF0, 0xC0, 0xC0, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x30, 0x0C, 0x0C, 0x00,
+	0x00, 0x00, 0xF0, 0x30, 0x30, 0x30, 0xF0, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+	0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xC0,
+	0xC0, 0xC0, 0xFF, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xC0,
+	0xFF, 0x00, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00,
+	0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xC0, 0xC0,
+	0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00,
+	0xFF, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00,
+	0xFF, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00,
+	0xC3, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0,
+	0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0C, 0x00,
+	0x0C, 0x00, 0x0C, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0xC0,
+	0x00, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC3, 0x00,
+	0xFC, 0x00, 0xC3, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00,
+	0xC0, 0x00, 0xC0, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xF3, 0xC0,
+	0xCC, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xF0, 0xC0,
+	0xCC, 0xC0, 0xC3, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xC0, 0xC0,
+	0xC0, 0xC0, 0xC0, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xC0, 0xC0,
+	0xFF, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0xC0,
+	0xC0, 0xC0, 0xFF, 0xC0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xC0, 0xC0,
+	0xFF, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0xC0, 0x00,
+	0xFF, 0xC0, 0x00, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x0C, 0x00,
+	0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0,
+	0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0,
+	0x33, 0x00, 0x33, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0,
+	0xCC, 0xC0, 0xCC, 0xC0, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x33, 0x00,
+	0x0C, 0x00, 0x33, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0,
+	0x33, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x03, 0x00,
+	0x0C, 0x00, 0x30, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x30, 0xF0, 0x30, 0x3C, 0x00,
+	0x00, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xF0, 0x30, 0x3C, 0x30, 0xF0, 0x00,
+	0x33, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const ILI9341_Font_Glyph ILI9341_Font_Prop_2_glyphs[] =
+{
+	{    0,  0,  6 },	/* ' ' */
+	{    0,  2,  4 },	/* '!' */
+	{    8,  6,  8 },	/* '"' */
+	{   16, 10, 12 },	/* '#' */
+	{   32, 10, 12 },	/* '$' */
+	{   48, 10, 12 },	/* '%' */
+	{   64, 10, 12 },	/* '&' */
+	{   80,  2,  4 },	/* ''' */
+	{   88,  4,  6 },	/* '(' */
+	{   96,  4,  6 },	/* ')' */
+	{  104,  6,  8 },	/* '*' */
+	{  112, 10, 12 },	/* '+' */
+	{  128,  2,  4 },	/* ',' */
+	{  136, 10, 12 },	/* '-' */
+	{  152,  2,  4 },	/* '.' */
+	{  160,  6,  8 },	/* '/' */
+	{  168, 10, 12 },	/* '0' */
+	{  184, 10, 12 },	/* '1' */
+	{  200, 10, 12 },	/* '2' */
+	{  216, 10, 12 },	/* '3' */
+	{  232, 10, 12 },	/* '4' */
+	{  248, 10, 12 },	/* '5' */
+	{  264, 10, 12 },	/* '6' */
+	{  280, 10, 12 },	/* '7' */
+	{  296, 10, 12 },	/* '8' */
+	{  312, 10, 12 },	/* '9' */
+	{  328,  2,  4 },	/* ':' */
+	{  336,  2,  4 },	/* ';' */
+	{  344,  6,  8 },	/* '<' */
+	{  352, 10, 12 },	/* '=' */
+	{  368,  6,  8 },	/* '>' */
+	{  376,  8, 10 },	/* '?' */
+	{  384, 10, 12 },	/* '@' */
+	{  400, 10, 12 },	/* 'A' */
+	{  416, 10, 12 },	/* 'B' */
+	{  432, 10, 12 },	/* 'C' */
+	{  448, 10, 12 },	/* 'D' */
+	{  464, 10, 12 },	/* 'E' */
+	{  480, 10, 12 },	/* 'F' */
+	{  496, 10, 12 },	/* 'G' */
+	{  512, 10, 12 },	/* 'H' */
+	{  528, 10, 12 },	/* 'I' */
+	{  544, 10, 12 },	/* 'J' */
+	{  560, 10, 12 },	/* 'K' */
+	{  576, 10, 12 },	/* 'L' */
+	{  592, 10, 12 },	/* 'M' */
+	{  608, 10, 12 },	/* 'N' */
+	{  624, 10, 12 },	/* 'O' */
+	{  640, 10, 12 },	/* 'P' */
+	{  656, 10, 12 },	/* 'Q' */
+	{  672, 10, 12 },	/* 'R' */
+	{  688, 10, 12 },	/* 'S' */
+	{  704, 10, 12 },	/* 'T' */
+	{  720, 10, 12 },	/* 'U' */
+	{  736, 10, 12 },	/* 'V' */
+	{  752, 10, 12 },	/* 'W' */
+	{  768, 10, 12 },	/* 'X' */
+	{  784, 10, 12 },	/* 'Y' */
+	{  800, 10, 12 },	/* 'Z' */
+	{  816,  4,  6 },	/* '[' */
+	{  824,  6,  8 },	/* '\' */
+	{  832,  4,  6 },	/* ']' */
+	{  840,  6,  8 },	/* '^' */
+	{  848, 12, 14 },	/* '_' */
+	{  864,  2,  4 },	/* '`' */
+	{  872, 10, 12 },	/* 'a' */
+	{  888, 10, 12 },	/* 'b' */
+	{  904, 10, 12 },	/* 'c' */
+	{  920, 10, 12 },	/* 'd' */
+	{  936, 10, 12 },	/* 'e' */
+	{  952, 10, 12 },	/* 'f' */
+	{  968, 10, 12 },	/* 'g' */
+	{  984, 10, 12 },	/* 'h' */
+	{ 1000, 10, 12 },	/* 'i' */
+	{ 1016, 10, 12 },	/* 'j' */
+	{ 1032, 10, 12 },	/* 'k' */
+	{ 1048, 10, 12 },	/* 'l' */
+	{ 1064, 10, 12 },	/* 'm' */
+	{ 1080, 10, 12 },	/* 'n' */
+	{ 1096, 10, 12 },	/* 'o' */
+	{ 1112, 10, 12 },	/* 'p' */
+	{ 1128, 10, 12 },	/* 'q' */
+	{ 1144, 10, 12 },	/* 'r' */
+	{ 1160, 10, 12 },	/* 's' */
+	{ 1176, 10, 12 },	/* 't' */
+	{ 1192, 10, 12 },	/* 'u' */
+	{ 1208, 10, 12 },	/* 'v' */
+	{ 1224, 10, 12 },	/* 'w' */
+	{ 1240, 10, 12 },	/* 'x' */
+	{ 1256, 10, 12 },	/* 'y' */
+	{ 1272, 10, 12 },	/* 'z' */
+	{ 1288,  6,  8 },	/* '{' */
+	{ 1296,  2,  4 },	/* '|' */
+	{ 1304,  6,  8 },	/* '}' */
+	{ 1312,  8, 10 },	/* '~' */
+	{ 1320,  0,  6 },	/* DEL */
+};
+
+static const ILI9341_Font_Kern ILI9341_Font_Prop_2_kerns[] =
+{
+	{ '"', ',', -2 }, { '"', '-', -2 }, { '"', '.', -2 }, { '"', 'J', -2 }, { '"', 'j', -2 }, { '\'', ',', -2 },
+	{ '\'', '-', -2 }, { '\'', '.', -2 }, { '\'', 'J', -2 }, { '\'', 'j', -2 }, { ',', '"', -2 }, { ',', '\'', -2 },
+	{ ',', '-', -2 }, { ',', 'T', -2 }, { ',', 'V', -2 }, { ',', 'Y', -2 }, { ',', 't', -2 }, { ',', 'v', -2 },
+	{ ',', 'y', -2 }, { '-', '"', -2 }, { '-', '\'', -2 }, { '-', ',', -2 }, { '-', '.', -2 }, { '-', ':', -2 },
+	{ '-', ';', -2 }, { '-', 'I', -2 }, { '-', 'T', -2 }, { '-', 'X', -2 }, { '-', 'Z', -2 }, { '-', 'i', -2 },
+	{ '-', 't', -2 }, { '-', 'x', -2 }, { '-', 'z', -2 }, { '.', '"', -2 }, { '.', '\'', -2 }, { '.', '-', -2 },
+	{ '.', 'T', -2 }, { '.', 'V', -2 }, { '.', 'Y', -2 }, { '.', 't', -2 }, { '.', 'v', -2 }, { '.', 'y', -2 },
+	{ ':', '-', -2 }, { ';', '-', -2 }, { 'C', '-', -2 }, { 'E', '-', -2 }, { 'F', ',', -2 }, { 'F', '-', -2 },
+	{ 'F', '.', -2 }, { 'F', 'J', -2 }, { 'F', 'j', -2 }, { 'I', '-', -2 }, { 'K', '-', -2 }, { 'L', '"', -2 },
+	{ 'L', '\'', -2 }, { 'L', '-', -2 }, { 'L', 'T', -2 }, { 'L', 'V', -2 }, { 'L', 'Y', -2 }, { 'L', 't', -2 },
+	{ 'L', 'v', -2 }, { 'L', 'y', -2 }, { 'P', ',', -2 }, { 'P', '.', -2 }, { 'P', 'J', -2 }, { 'P', 'j', -2 },
+	{ 'T', ',', -2 }, { 'T', '-', -2 }, { 'T', '.', -2 }, { 'T', 'J', -2 }, { 'T', 'j', -2 }, { 'V', ',', -2 },
+	{ 'V', '.', -2 }, { 'V', 'J', -2 }, { 'V', 'j', -2 }, { 'X', '-', -2 }, { 'Y', ',', -2 }, { 'Y', '.', -2 },
+	{ 'Y', 'J', -2 }, { 'Y', 'j', -2 }, { 'Z', '-', -2 }, { 'c', '-', -2 }, { 'e', '-', -2 }, { 'f', ',', -2 },
+	{ 'f', '-', -2 }, { 'f', '.', -2 }, { 'f', 'J', -2 }, { 'f', 'j', -2 }, { 'i', '-', -2 }, { 'k', '-', -2 },
+	{ 'l', '"', -2 }, { 'l', '\'', -2 }, { 'l', '-', -2 }, { 'l', 'T', -2 }, { 'l', 'V', -2 }, { 'l', 'Y', -2 },
+	{ 'l', 't', -2 }, { 'l', 'v', -2 }, { 'l', 'y', -2 }, { 'p', ',', -2 }, { 'p', '.', -2 }, { 'p', 'J', -2 },
+	{ 'p', 'j', -2 }, { 't', ',', -2 }, { 't', '-', -2 }, { 't', '.', -2 }, { 't', 'J', -2 }, { 't', 'j', -2 },
+	{ 'v', ',', -2 }, { 'v', '.', -2 }, { 'v', 'J', -2 }, { 'v', 'j', -2 }, { 'x', '-', -2 }, { 'y', ',', -2 },
+	{ 'y', '.', -2 }, { 'y', 'J', -2 }, { 'y', 'j', -2 }, { 'z', '-', -2 },
+};
+
+const ILI9341_Font ILI9341_Font_Prop_2 =
+{
+	16, 2, ' ', 96,
+	ILI9341_Font_Prop_2_glyphs, ILI9341_Font_Prop_2_bitmaps,
+	118, ILI9341_Font_Prop_2_kerns
+};
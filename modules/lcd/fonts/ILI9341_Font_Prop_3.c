@@ -0,0 +1,226 @@
+/* Generated by tools/lcd_font from modules/lcd/5x5_font.h: size 3, proportional, 1416 bytes of bitmaps, 118 kerning pairs */
+#include <lcd/ILI9341_Font.h>
+
+static const uint8_t ILI9341_Font_Prop_3_bitmaps[] =
+{
+	0x00, 0x00, 0xE0, 0xE0, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE3, 0x80, 0xE3, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x70, 0xFF, 0xFE,
+	0x1C, 0x70, 0xFF, 0xFE, 0x1C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xFF, 0xFE, 0xE3, 0x80,
+	0xFF, 0xFE, 0x03, 0x8E, 0xFF, 0xFE, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0x70,
+	0x03, 0x80, 0x1C, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xE0, 0x00,
+	0x1F, 0x8E, 0xE0, 0x70, 0x1F, 0x8E, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1C, 0xE0, 0xE0, 0xE0, 0x1C, 0x00, 0x00, 0x00, 0xE0, 0x1C, 0x1C, 0x1C, 0xE0, 0x00,
+	0x1C, 0x00, 0xFF, 0x80, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0xFF, 0xFE, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x7E, 0xE3, 0x8E, 0xFC, 0x0E, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x1F, 0x80, 0x03, 0x80, 0x03, 0x80, 0x1F, 0xF0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x0E, 0x1F, 0xF0, 0xE0, 0x00, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x0E, 0x1F, 0xF0, 0x00, 0x0E, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE3, 0x80, 0xFF, 0xFE, 0x03, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x00, 0xFF, 0xF0, 0x00, 0x0E, 0xFF, 0xF0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x00, 0xFF, 0xFE, 0xE0, 0x0E, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x0E, 0xFF, 0xFE, 0xE0, 0x0E, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x0E, 0xFF, 0xFE, 0x00, 0x0E, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0xE0,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0xE0, 0x70, 0x03, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x0E, 0xE3, 0xFE, 0xE0, 0x00, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x0E, 0xE0, 0x0E, 0xFF, 0xFE, 0xE0, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x0E, 0xFF, 0xF0, 0xE0, 0x0E, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xFF, 0xF0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x00, 0xFF, 0xF0, 0xE0, 0x00, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x00, 0xFF, 0xF0, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x00, 0xE0, 0x7E, 0xE0, 0x0E, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0xE0, 0x0E, 0xFF, 0xFE, 0xE0, 0x0E, 0xE0, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x0E, 0x00, 0x0E, 0xE0, 0x0E, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0xE0, 0x70, 0xFF, 0x80, 0xE0, 0x70, 0xE0, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0xFC, 0x7E, 0xE3, 0x8E, 0xE0, 0x0E, 0xE0, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0xFC, 0x0E, 0xE3, 0x8E, 0xE0, 0x7E, 0xE0, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0x1F, 0xF0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xE0, 0x0E, 0xFF, 0xF0, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x0E, 0xE0, 0x0E, 0xFF, 0xFE, 0x03, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xE0, 0x0E, 0xFF, 0xF0, 0xE0, 0x0E, 0xE0, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x00, 0xFF, 0xFE, 0x00, 0x0E, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0xE0, 0x0E, 0x1C, 0x70, 0x1C, 0x70, 0x03, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0xE0, 0x0E, 0xE3, 0x8E, 0xE3, 0x8E, 0x1C, 0x70, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x1C, 0x70, 0x03, 0x80, 0x1C, 0x70, 0xE0, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0xE0, 0x0E, 0x1C, 0x70, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0xFC, 0xE0, 0xE0, 0xE0, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+	0x1C, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1C, 0x1C, 0x1C, 0xFC, 0x00,
+	0xE3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x0E, 0xE0, 0x0E, 0xFF, 0xFE, 0xE0, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x0E, 0xFF, 0xF0, 0xE0, 0x0E, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xFF, 0xF0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x00, 0xFF, 0xF0, 0xE0, 0x00, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x00, 0xFF, 0xF0, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x00, 0xE0, 0x7E, 0xE0, 0x0E, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0xE0, 0x0E, 0xFF, 0xFE, 0xE0, 0x0E, 0xE0, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x0E, 0x00, 0x0E, 0xE0, 0x0E, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0xE0, 0x70, 0xFF, 0x80, 0xE0, 0x70, 0xE0, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0xFC, 0x7E, 0xE3, 0x8E, 0xE0, 0x0E, 0xE0, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0xFC, 0x0E, 0xE3, 0x8E, 0xE0, 0x7E, 0xE0, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0x1F, 0xF0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xE0, 0x0E, 0xFF, 0xF0, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x0E, 0xE0, 0x0E, 0xFF, 0xFE, 0x03, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0xE0, 0x0E, 0xFF, 0xF0, 0xE0, 0x0E, 0xE0, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xE0, 0x00, 0xFF, 0xFE, 0x00, 0x0E, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x0E, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0xE0, 0x0E, 0x1C, 0x70, 0x1C, 0x70, 0x03, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0xE0, 0x0E, 0xE3, 0x8E, 0xE3, 0x8E, 0x1C, 0x70, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x1C, 0x70, 0x03, 0x80, 0x1C, 0x70, 0xE0, 0x0E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0xE0, 0x0E, 0x1C, 0x70, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xFF, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x1C, 0x00, 0xFC, 0x00, 0x1C, 0x00, 0x1F, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0xE0, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x1C, 0x00,
+	0x1F, 0x80, 0x1C, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x1C, 0x70, 0xE3, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const ILI9341_Font_Glyph ILI9341_Font_Prop_3_glyphs[] =
+{
+	{    0,  0,  9 },	/* ' ' */
+	{    0,  3,  6 },	/* '!' */
+	{    8,  9, 12 },	/* '"' */
+	{   24, 15, 18 },	/* '#' */
+	{   40, 15, 18 },	/* '$' */
+	{   56, 15, 18 },	/* '%' */
+	{   72, 15, 18 },	/* '&' */
+	{   88,  3,  6 },	/* ''' */
+	{   96,  6,  9 },	/* '(' */
+	{  104,  6,  9 },	/* ')' */
+	{  112,  9, 12 },	/* '*' */
+	{  128, 15, 18 },	/* '+' */
+	{  144,  3,  6 },	/* ',' */
+	{  152, 15, 18 },	/* '-' */
+	{  168,  3,  6 },	/* '.' */
+	{  176,  9, 12 },	/* '/' */
+	{  192, 15, 18 },	/* '0' */
+	{  208, 15, 18 },	/* '1' */
+	{  224, 15, 18 },	/* '2' */
+	{  240, 15, 18 },	/* '3' */
+	{  256, 15, 18 },	/* '4' */
+	{  272, 15, 18 },	/* '5' */
+	{  288, 15, 18 },	/* '6' */
+	{  304, 15, 18 },	/* '7' */
+	{  320, 15, 18 },	/* '8' */
+	{  336, 15, 18 },	/* '9' */
+	{  352,  3,  6 },	/* ':' */
+	{  360,  3,  6 },	/* ';' */
+	{  368,  9, 12 },	/* '<' */
+	{  384, 15, 18 },	/* '=' */
+	{  400,  9, 12 },	/* '>' */
+	{  416, 12, 15 },	/* '?' */
+	{  432, 15, 18 },	/* '@' */
+	{  448, 15, 18 },	/* 'A' */
+	{  464, 15, 18 },	/* 'B' */
+	{  480, 15, 18 },	/* 'C' */
+	{  496, 15, 18 },	/* 'D' */
+	{  512, 15, 18 },	/* 'E' */
+	{  528, 15, 18 },	/* 'F' */
+	{  544, 15, 18 },	/* 'G' */
+	{  560, 15, 18 },	/* 'H' */
+	{  576, 15, 18 },	/* 'I' */
+	{  592, 15, 18 },	/* 'J' */
+	{  608, 15, 18 },	/* 'K' */
+	{  624, 15, 18 },	/* 'L' */
+	{  640, 15, 18 },	/* 'M' */
+	{  656, 15, 18 },	/* 'N' */
+	{  672, 15, 18 },	/* 'O' */
+	{  688, 15, 18 },	/* 'P' */
+	{  704, 15, 18 },	/* 'Q' */
+	{  720, 15, 18 },	/* 'R' */
+	{  736, 15, 18 },	/* 'S' */
+	{  752, 15, 18 },	/* 'T' */
+	{  768, 15, 18 },	/* 'U' */
+	{  784, 15, 18 },	/* 'V' */
+	{  800, 15, 18 },	/* 'W' */
+	{  816, 15, 18 },	/* 'X' */
+	{  832, 15, 18 },	/* 'Y' */
+	{  848, 15, 18 },	/* 'Z' */
+	{  864,  6,  9 },	/* '[' */
+	{  872,  9, 12 },	/* '\' */
+	{  888,  6,  9 },	/* ']' */
+	{  896,  9, 12 },	/* '^' */
+	{  912, 18, 21 },	/* '_' */
+	{  936,  3,  6 },	/* '`' */
+	{  944, 15, 18 },	/* 'a' */
+	{  960, 15, 18 },	/* 'b' */
+	{  976, 15, 18 },	/* 'c' */
+	{  992, 15, 18 },	/* 'd' */
+	{ 1008, 15, 18 },	/* 'e' */
+	{ 1024, 15, 18 },	/* 'f' */
+	{ 1040, 15, 18 },	/* 'g' */
+	{ 1056, 15, 18 },	/* 'h' */
+	{ 1072, 15, 18 },	/* 'i' */
+	{ 1088, 15, 18 },	/* 'j' */
+	{ 1104, 15, 18 },	/* 'k' */
+	{ 1120, 15, 18 },	/* 'l' */
+	{ 1136, 15, 18 },	/* 'm' */
+	{ 1152, 15, 18 },	/* 'n' */
+	{ 1168, 15, 18 },	/* 'o' */
+	{ 1184, 15, 18 },	/* 'p' */
+	{ 1200, 15, 18 },	/* 'q' */
+	{ 1216, 15, 18 },	/* 'r' */
+	{ 1232, 15, 18 },	/* 's' */
+	{ 1248, 15, 18 },	/* 't' */
+	{ 1264, 15, 18 },	/* 'u' */
+	{ 1280, 15, 18 },	/* 'v' */
+	{ 1296, 15, 18 },	/* 'w' */
+	{ 1312, 15, 18 },	/* 'x' */
+	{ 1328, 15, 18 },	/* 'y' */
+	{ 1344, 15, 18 },	/* 'z' */
+	{ 1360,  9, 12 },	/* '{' */
+	{ 1376,  3,  6 },	/* '|' */
+	{ 1384,  9, 12 },	/* '}' */
+	{ 1400, 12, 15 },	/* '~' */
+	{ 1416,  0,  9 },	/* DEL */
+};
+
+static const ILI9341_Font_Kern ILI9341_Font_Prop_3_kerns[] =
+{
+	{ '"', ',', -3 }, { '"', '-', -3 }, { '"', '.', -3 }, { '"', 'J', -3 }, { '"', 'j', -3 }, { '\'', ',', -3 },
+	{ '\'', '-', -3 }, { '\'', '.', -3 }, { '\'', 'J', -3 }, { '\'', 'j', -3 }, { ',', '"', -3 }, { ',', '\'', -3 },
+	{ ',', '-', -3 }, { ',', 'T', -3 }, { ',', 'V', -3 }, { ',', 'Y', -3 }, { ',', 't', -3 }, { ',', 'v', -3 },
+	{ ',', 'y', -3 }, { '-', '"', -3 }, { '-', '\'', -3 }, { '-', ',', -3 }, { '-', '.', -3 }, { '-', ':', -3 },
+	{ '-', ';', -3 }, { '-', 'I', -3 }, { '-', 'T', -3 }, { '-', 'X', -3 }, { '-', 'Z', -3 }, { '-', 'i', -3 },
+	{ '-', 't', -3 }, { '-', 'x', -3 }, { '-', 'z', -3 }, { '.', '"', -3 }, { '.', '\'', -3 }, { '.', '-', -3 },
+	{ '.', 'T', -3 }, { '.', 'V', -3 }, { '.', 'Y', -3 }, { '.', 't', -3 }, { '.', 'v', -3 }, { '.', 'y', -3 },
+	{ ':', '-', -3 }, { ';', '-', -3 }, { 'C', '-', -3 }, { 'E', '-', -3 }, { 'F', ',', -3 }, { 'F', '-', -3 },
+	{ 'F', '.', -3 }, { 'F', 'J', -3 }, { 'F', 'j', -3 }, { 'I', '-', -3 }, { 'K', '-', -3 }, { 'L', '"', -3 },
+	{ 'L', '\'', -3 }, { 'L', '-', -3 }, { 'L', 'T', -3 }, { 'L', 'V', -3 }, { 'L', 'Y', -3 }, { 'L', 't', -3 },
+	{ 'L', 'v', -3 }, { 'L', 'y', -3 }, { 'P', ',', -3 }, { 'P', '.', -3 }, { 'P', 'J', -3 }, { 'P', 'j', -3 },
+	{ 'T', ',', -3 }, { 'T', '-', -3 }, { 'T', '.', -3 }, { 'T', 'J', -3 }, { 'T', 'j', -3 }, { 'V', ',', -3 },
+	{ 'V', '.', -3 }, { 'V', 'J', -3 }, { 'V', 'j', -3 }, { 'X', '-', -3 }, { 'Y', ',', -3 }, { 'Y', '.', -3 },
+	{ 'Y', 'J', -3 }, { 'Y', 'j', -3 }, { 'Z', '-', -3 }, { 'c', '-', -3 }, { 'e', '-', -3 }, { 'f', ',', -3 },
+	{ 'f', '-', -3 }, { 'f', '.', -3 }, { 'f', 'J', -3 }, { 'f', 'j', -3 }, { 'i', '-', -3 }, { 'k', '-', -3 },
+	{ 'l', '"', -3 }, { 'l', '\'', -3 }, { 'l', '-', -3 }, { 'l', 'T', -3 }, { 'l', 'V', -3 }, { 'l', 'Y', -3 },
+	{ 'l', 't', -3 }, { 'l', 'v', -3 }, { 'l', 'y', -3 }, { 'p', ',', -3 }, { 'p', '.', -3 }, { 'p', 'J', -3 },
+	{ 'p', 'j', -3 }, { 't', ',', -3 }, { 't', '-', -3 }, { 't', '.', -3 }, { 't', 'J', -3 }, { 't', 'j', -3 },
+	{ 'v', ',', -3 }, { 'v', '.', -3 }, { 'v', 'J', -3 }, { 'v', 'j', -3 }, { 'x', '-', -3 }, { 'y', ',', -3 },
+	{ 'y', '.', -3 }, { 'y', 'J', -3 }, { 'y', 'j', -3 }, { 'z', '-', -3 },
+};
+
+const ILI9341_Font ILI9341_Font_Prop_3 =
+{
+	24, 3, ' ', 96,
+	ILI9341_Font_Prop_3_glyphs, ILI9341_Font_Prop_3_bitmaps,
+	118, ILI9341_Font_Prop_3_kerns
+};
@@ -10,18 +10,20 @@
 #include <lcd/ILI9341_STM32_Driver.h>
 #include <lcd/lcd.h>
 #include "stm32f4xx.h"
+#include <string.h>
 
 /**
  * Initializes the LCD
  */
 void lcd_init(void)
 {
-	/* Initialization of the LCD */
-	ILI9341_Init();
+	/* Initialization of the LCD, the panel wakes up from sleep while the screen is cleared */
+	ILI9341_Init_Start();
 
-	/* Clear screen with white color */
+	/* Clear screen with white color, the orientation is ILI9341_ROTATION (SCREEN_VERTICAL_2 unless the project defines another one) */
 	ILI9341_Fill_Screen(WHITE);
-	ILI9341_Set_Rotation(SCREEN_VERTICAL_2);
+
+	ILI9341_Init_Finish();
 }
 
 
@@ -54,6 +56,200 @@ void lcd_draw_text_at_coord(const char* text, uint16_t x, uint16_t y, uint16_t c
 	ILI9341_Draw_Text(text, x, y, color, size, background_color);
 }
 
+/**
+ * Draws a text with a glyph atlas, e.g. the proportional ILI9341_Font_Prop_2.
+ * The text and its background go to the display through one address window.
+ * @param	text	The text to draw
+ * @param 	x		The x coordinate on the screen
+ * @param 	y		The y coordinate on the screen
+ * @param	font	The font, see ILI9341_Font.h
+ * @param	color	The text color
+ * @param	background_color	The background color
+ */
+void lcd_draw_text_font(const char* text, uint16_t x, uint16_t y, const ILI9341_Font* font, uint16_t color, uint16_t background_color)
+{
+	ILI9341_Draw_Text_Font(font, text, x, y, color, background_color);
+}
+
+/**
+ * Returns the width in pixels a text takes when drawn with lcd_draw_text_font().
+ * @param	text	The text
+ * @param	font	The font
+ */
+uint16_t lcd_get_text_width(const char* text, const ILI9341_Font* font)
+{
+	return ILI9341_Get_Text_Width(font, text, strlen(text));
+}
+
+/**
+ * Initializes a text field. Nothing is drawn until lcd_text_field_draw() is called.
+ * @param	field	The text field
+ * @param 	x		The x coordinate on the screen
+ * @param 	y		The y coordinate on the screen
+ * @param	color	The text color
+ * @param	size	The text size
+ * @param	background_color	The background color
+ */
+void lcd_text_field_init(lcd_text_field_t* field, uint16_t x, uint16_t y, uint16_t color, uint16_t size, uint16_t background_color)
+{
+	field->x = x;
+	field->y = y;
+	field->color = color;
+	field->size = size;
+	field->background_color = background_color;
+	field->length = 0;
+	field->valid = 0;
+}
+
+/**
+ * Pixels the changed cells of a text field are put together in before they are sent.
+ */
+static uint16_t text_field_pixels[LCD_TEXT_FIELD_REGION_PIXELS];
+static ILI9341_Region text_field_region;
+
+/**
+ * Returns 1 if character i of text differs from what the text field shows.
+ */
+static uint8_t lcd_text_field_changed(const lcd_text_field_t* field, const char* text, uint8_t i)
+{
+	return !field->valid || (i >= field->length) || (field->text[i] != text[i]);
+}
+
+/**
+ * Draws the cells first to end - 1 of a text at x, and clears clear_width pixels after them.
+ * Several cells are drawn into a RAM region first and sent through one address window.
+ * Returns the x after the last cell.
+ */
+static uint16_t lcd_text_field_draw_run(lcd_text_field_t* field, const char* text, uint8_t first, uint8_t end, uint16_t x, uint16_t clear_width)
+{
+	uint16_t height = ILI9341_Get_Char_Height(field->size);
+	uint16_t width = clear_width;
+	uint8_t cells = end - first + (clear_width ? 1 : 0);
+
+	for(uint8_t i = first; i < end; i++)
+	{
+		width += ILI9341_Get_Char_Width(text[i], field->size);
+	}
+
+	/* Not while the display list or a region of the caller takes the drawing calls */
+	uint8_t combined = (cells > 1) && !ILI9341_Queue_Active && !ILI9341_Region_Active
+			&& ((uint32_t)width * height <= LCD_TEXT_FIELD_REGION_PIXELS);
+	if(combined)
+	{
+		ILI9341_Region_Init(&text_field_region, text_field_pixels, x, field->y, width, height);
+		ILI9341_Region_Begin(&text_field_region);
+	}
+
+	for(uint8_t i = first; i < end; i++)
+	{
+		ILI9341_Draw_Char(text[i], x, field->y, field->color, field->size, field->background_color);
+		field->text[i] = text[i];
+		x += ILI9341_Get_Char_Width(text[i], field->size);
+	}
+	if(clear_width)
+	{
+		ILI9341_Draw_Rectangle(x, field->y, clear_width, height, field->background_color);
+	}
+
+	if(combined)
+	{
+		ILI9341_Region_End();
+	}
+	return x;
+}
+
+/**
+ * Draws a text into a text field.
+ * Only the character cells that differ from the last drawn text are sent,
+ * cells of a longer previous text are cleared with the background color.
+ * Neighbouring changed cells are drawn into a RAM region first and sent
+ * through one address window, so the panel never shows them half drawn.
+ * @param	field	The text field
+ * @param	text	The text to draw
+ */
+void lcd_text_field_draw(lcd_text_field_t* field, const char* text)
+{
+	uint16_t x = field->x;
+	uint16_t clear_width = 0;
+	uint8_t length = 0;
+	uint8_t i = 0;
+
+	while((length < LCD_TEXT_FIELD_MAX_LEN) && text[length]) length++;
+
+	/* What is left of a longer previous text is cleared */
+	if(field->valid)
+	{
+		for(uint8_t k = length; k < field->length; k++)
+		{
+			clear_width += ILI9341_Get_Char_Width(field->text[k], field->size);
+		}
+	}
+
+	while((i < length) || clear_width)
+	{
+		if((i < length) && !lcd_text_field_changed(field, text, i))
+		{
+			x += ILI9341_Get_Char_Width(text[i], field->size);
+			i++;
+			continue;
+		}
+
+		/* A run of changed cells, the cleared rest joins it when the run reaches the end of the text */
+		uint8_t end = i;
+		while((end < length) && lcd_text_field_changed(field, text, end)) end++;
+
+		x = lcd_text_field_draw_run(field, text, i, end, x, (end == length) ? clear_width : 0);
+		if(end == length) clear_width = 0;
+		i = end;
+	}
+
+	field->length = length;
+	field->valid = 1;
+}
+
+/**
+ * Draws a text into a text field when the caller already knows where it starts to differ,
+ * e.g. from the digits of a BCD counter. The cells before start are neither compared nor sent,
+ * the cells from start on are sent as one run without comparing them.
+ * Falls back to lcd_text_field_draw() when the screen content is unknown or the length changed.
+ * @param	field	The text field
+ * @param	text	The text to draw
+ * @param	start	First cell that may differ from the drawn text
+ */
+void lcd_text_field_draw_from(lcd_text_field_t* field, const char* text, uint8_t start)
+{
+	uint16_t x = field->x;
+	uint8_t length = 0;
+
+	while((length < LCD_TEXT_FIELD_MAX_LEN) && text[length]) length++;
+
+	if(!field->valid || (length != field->length))
+	{
+		lcd_text_field_draw(field, text);
+		return;
+	}
+	if(start >= length)
+	{
+		return;
+	}
+
+	for(uint8_t i = 0; i < start; i++)
+	{
+		x += ILI9341_Get_Char_Width(field->text[i], field->size);
+	}
+	lcd_text_field_draw_run(field, text, start, length, x, 0);
+}
+
+/**
+ * Marks the screen content of a text field as unknown, e.g. after the screen was cleared.
+ * The next lcd_text_field_draw() redraws the whole text.
+ * @param	field	The text field
+ */
+void lcd_text_field_invalidate(lcd_text_field_t* field)
+{
+	field->valid = 0;
+}
+
 /**
  * Fills the screen with a color.
  * @param color	The color to fill the screen
@@ -128,6 +324,91 @@ void lcd_draw_vertical_line(uint16_t x, uint16_t y, uint16_t height, uint16_t co
 	ILI9341_Draw_Vertical_Line(x, y, height, color);
 }
 
+/**
+ * Draws a line to the screen, both end points included.
+ * The coordinates may lie outside of the screen, the line is clipped.
+ * @param x0		The x coordinate of the first point
+ * @param y0		The y coordinate of the first point
+ * @param x1		The x coordinate of the second point
+ * @param y1		The y coordinate of the second point
+ * @param color		The color of the line
+ */
+void lcd_draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+	ILI9341_Draw_Line(x0, y0, x1, y1, color);
+}
+
+/**
+ * Draws lines from each point to the next one.
+ * @param points	The points, count of them
+ * @param count		The number of points
+ * @param color		The color of the lines
+ */
+void lcd_draw_polyline(const ILI9341_Point* points, uint16_t count, uint16_t color)
+{
+	ILI9341_Draw_Polyline(points, count, color);
+}
+
+/**
+ * Draws a triangle to the screen.
+ * @param x0, y0	The first corner
+ * @param x1, y1	The second corner
+ * @param x2, y2	The third corner
+ * @param color		The color of the triangle
+ * @param filled	0 if the triangle should not be filled, otherwise != 0
+ */
+void lcd_draw_triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color, uint8_t filled)
+{
+	if(filled)
+	{
+		ILI9341_Draw_Filled_Triangle(x0, y0, x1, y1, x2, y2, color);
+	}
+	else
+	{
+		ILI9341_Draw_Hollow_Triangle(x0, y0, x1, y1, x2, y2, color);
+	}
+}
+
+/**
+ * Draws a rectangle with rounded corners to the screen.
+ * @param x			The x coordinate of the upper left corner
+ * @param y			The y coordinate of the upper left corner
+ * @param width		The width of the rectangle
+ * @param height	The height of the rectangle
+ * @param radius	The radius of the corners, at most half of the shorter side
+ * @param color		The color of the rectangle
+ * @param filled	0 if the rectangle should not be filled, otherwise != 0
+ */
+void lcd_draw_round_rect(int16_t x, int16_t y, int16_t width, int16_t height, int16_t radius, uint16_t color, uint8_t filled)
+{
+	if(filled)
+	{
+		ILI9341_Draw_Filled_Round_Rectangle(x, y, width, height, radius, color);
+	}
+	else
+	{
+		ILI9341_Draw_Hollow_Round_Rectangle(x, y, width, height, radius, color);
+	}
+}
+
+/**
+ * Limits lines, triangles, rounded rectangles and circles to a rectangle.
+ * @param x0, y0	The upper left corner of the rectangle
+ * @param x1, y1	The lower right corner of the rectangle, included
+ */
+void lcd_set_clip(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+	ILI9341_Set_Clip(x0, y0, x1, y1);
+}
+
+/**
+ * Lets lines, triangles, rounded rectangles and circles use the whole screen again.
+ */
+void lcd_clip_off(void)
+{
+	ILI9341_Reset_Clip();
+}
+
 /**
  * Draws a pixel to the screen.
  * @param x		The x coordinate of the pixel
@@ -139,3 +420,162 @@ void lcd_draw_pixel(uint16_t x, uint16_t y, uint16_t color)
 	ILI9341_Draw_Pixel(x, y, color);
 }
 
+/**
+ * Draws a block of pixels with a single address window.
+ * @param x			The x coordinate of the upper left corner
+ * @param y			The y coordinate of the upper left corner
+ * @param width		The width of the block
+ * @param height	The height of the block
+ * @param colors	width*height colors, row by row
+ */
+void lcd_draw_pixels(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t* colors)
+{
+	ILI9341_Draw_Pixels(x, y, width, height, colors);
+}
+
+/**
+ * Draws an image from flash, converted with tools/lcd_image.
+ * Uncompressed images are sent by DMA without a copy, compressed ones are decoded on the fly.
+ * @param image		The image
+ * @param x			The x coordinate of the upper left corner
+ * @param y			The y coordinate of the upper left corner
+ */
+void lcd_draw_image(const ILI9341_Image* image, uint16_t x, uint16_t y)
+{
+	ILI9341_Draw_Bitmap(image, x, y);
+}
+
+/**
+ * Checks whether pixel data is still being sent to the display.
+ * Drawing calls return before their last pixels have left the SPI,
+ * the next drawing call waits for the transfer on its own.
+ * @return	1 while a DMA transfer is running, otherwise 0
+ */
+uint8_t lcd_is_busy(void)
+{
+	return ILI9341_Is_Busy();
+}
+
+/**
+ * Waits until all pixel data has been sent to the display.
+ */
+void lcd_wait_idle(void)
+{
+	ILI9341_Wait_Idle();
+}
+
+/**
+ * Defines a band of the screen that the display scrolls in hardware.
+ * The band runs along the long side of the screen: rows in portrait, columns in landscape orientation.
+ * Everything outside the band stays in place. The scroll offset starts at 0.
+ * Not meant to be used together with the compositor, the shadow does not know about scrolling.
+ * @param start		The first row (portrait) or column (landscape) of the band
+ * @param length	The number of rows or columns in the band
+ */
+void lcd_set_scroll_area(uint16_t start, uint16_t length)
+{
+	ILI9341_Set_Scroll_Area(start, length);
+}
+
+/**
+ * Scrolls the band by changing one display register, no pixel data is sent.
+ * The line start+offset is shown at the beginning of the band and the lines
+ * before it wrap around to the end. Drawing keeps using the unscrolled coordinates.
+ * @param offset	0 to length-1
+ */
+void lcd_scroll(uint16_t offset)
+{
+	ILI9341_Scroll(offset);
+}
+
+/**
+ * Shows the whole screen unscrolled again.
+ */
+void lcd_scroll_off(void)
+{
+	ILI9341_Scroll_Off();
+}
+
+/**
+ * Starts retained mode: the following drawing calls only write into 16x16 tile
+ * buffers from the pool of the shadow, lcd_flush() sends them.
+ * Without ILI9341_SHADOW_ENABLE the drawing calls keep going to the display.
+ */
+void lcd_compositor_begin(void)
+{
+	ILI9341_Shadow_Begin();
+}
+
+/**
+ * Ends retained mode, drawing calls go to the display again.
+ * Call lcd_flush() first so the drawn tiles reach the display.
+ */
+void lcd_compositor_end(void)
+{
+	ILI9341_Shadow_End();
+}
+
+/**
+ * Sends the drawn pixels of the tile buffers to the display, merged into
+ * rectangles, and empties the pool. Tiles drawn exactly as they were last
+ * sent are skipped. Does nothing without ILI9341_SHADOW_ENABLE.
+ */
+void lcd_flush(void)
+{
+	ILI9341_Shadow_Flush();
+}
+
+/**
+ * Starts drawing into a region buffer: the following drawing calls only write
+ * into the pixels of the region, lcd_region_end() sends it in one transfer.
+ * Between lcd_queue_begin() and lcd_queue_end() it waits until the display
+ * list has run empty; lcd_region_end() resumes the list.
+ * @param region	The region, see ILI9341_Region_Init()
+ */
+void lcd_region_begin(ILI9341_Region* region)
+{
+	ILI9341_Region_Begin(region);
+}
+
+/**
+ * Sends the region to the display through one address window, drawing calls
+ * go to the display or the display list again, as before lcd_region_begin().
+ * The next lcd_region_begin() waits for the transfer.
+ */
+void lcd_region_end(void)
+{
+	ILI9341_Region_End();
+}
+
+/**
+ * Starts the display list: fills, lines, text and images are only stored as
+ * commands and the DMA interrupt sends them, the call returns right away.
+ * Other drawing calls wait until the list has run empty and then draw directly.
+ * Has no effect while the compositor is active.
+ * @param policy	What a drawing call does when the list is full:
+ * 					ILI9341_QUEUE_BLOCK waits, ILI9341_QUEUE_DROP_OLDEST throws the
+ * 					oldest waiting command away, ILI9341_QUEUE_COALESCE merges fills of
+ * 					the same region and waits otherwise
+ */
+void lcd_queue_begin(uint8_t policy)
+{
+	ILI9341_Queue_Begin(policy);
+}
+
+/**
+ * Waits until the display list has been sent, drawing calls draw directly again.
+ */
+void lcd_queue_end(void)
+{
+	ILI9341_Queue_End();
+}
+
+/**
+ * Reads the counters of the display list: current and highest depth, stored,
+ * dropped and merged commands and the calls that had to wait for a free entry.
+ * @param stats		Receives the counters
+ */
+void lcd_queue_get_stats(ILI9341_Queue_Stats* stats)
+{
+	ILI9341_Queue_Get_Stats(stats);
+}
@@ -14,6 +14,12 @@
 #include "stm32f4xx.h"
 #include "ILI9341_STM32_Driver.h"
 #include "ILI9341_GFX.h"
+#include "ILI9341_Shadow.h"
+#include "ILI9341_Image.h"
+#include "ILI9341_Queue.h"
+#include "ILI9341_Font.h"
+#include "ILI9341_Shapes.h"
+#include "ILI9341_Region.h"
 
 /**
  * Colors:
@@ -21,6 +27,35 @@
  */
 
 
+/**
+ * Maximum number of characters a text field remembers, longer texts are cut off.
+ */
+#define LCD_TEXT_FIELD_MAX_LEN	24
+
+/**
+ * Pixels of the RAM region a text field puts two or more changed characters
+ * together in, 12 characters of size 2. Larger changes are drawn cell by cell.
+ */
+#ifndef LCD_TEXT_FIELD_REGION_PIXELS
+#define LCD_TEXT_FIELD_REGION_PIXELS	(12*12*16)
+#endif
+
+/**
+ * A text at a fixed position that is redrawn by lcd_text_field_draw().
+ * Only the characters that differ from the last drawn text are sent to the display.
+ */
+typedef struct
+{
+	uint16_t x;
+	uint16_t y;
+	uint16_t color;
+	uint16_t size;
+	uint16_t background_color;
+	uint8_t length;		/* characters currently on the screen */
+	uint8_t valid;		/* 0 if the screen content is unknown */
+	char text[LCD_TEXT_FIELD_MAX_LEN];
+} lcd_text_field_t;
+
 /**
  * Function prototypes
  */
@@ -28,6 +63,13 @@ void lcd_init(void);
 
 void lcd_draw_text_at_line(const char* text, uint8_t line, uint16_t color, uint16_t size, uint16_t background_color);
 void lcd_draw_text_at_coord(const char* text, uint16_t x, uint16_t y, uint16_t color, uint16_t size, uint16_t background_color);
+void lcd_draw_text_font(const char* text, uint16_t x, uint16_t y, const ILI9341_Font* font, uint16_t color, uint16_t background_color);
+uint16_t lcd_get_text_width(const char* text, const ILI9341_Font* font);
+
+void lcd_text_field_init(lcd_text_field_t* field, uint16_t x, uint16_t y, uint16_t color, uint16_t size, uint16_t background_color);
+void lcd_text_field_draw(lcd_text_field_t* field, const char* text);
+void lcd_text_field_draw_from(lcd_text_field_t* field, const char* text, uint8_t start);
+void lcd_text_field_invalidate(lcd_text_field_t* field);
 
 void lcd_fill_screen(uint16_t color);
 
@@ -35,7 +77,33 @@ void lcd_draw_rect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t
 void lcd_draw_circle(uint16_t x, uint16_t y, uint16_t r, uint16_t color, uint8_t filled);
 void lcd_draw_horizontal_line(uint16_t x, uint16_t y, uint16_t width, uint16_t color);
 void lcd_draw_vertical_line(uint16_t x, uint16_t y, uint16_t height, uint16_t color);
+void lcd_draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+void lcd_draw_polyline(const ILI9341_Point* points, uint16_t count, uint16_t color);
+void lcd_draw_triangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color, uint8_t filled);
+void lcd_draw_round_rect(int16_t x, int16_t y, int16_t width, int16_t height, int16_t radius, uint16_t color, uint8_t filled);
+void lcd_set_clip(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+void lcd_clip_off(void);
 void lcd_draw_pixel(uint16_t x, uint16_t y, uint16_t color);
+void lcd_draw_pixels(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t* colors);
+void lcd_draw_image(const ILI9341_Image* image, uint16_t x, uint16_t y);
+
+uint8_t lcd_is_busy(void);
+void lcd_wait_idle(void);
+
+void lcd_set_scroll_area(uint16_t start, uint16_t length);
+void lcd_scroll(uint16_t offset);
+void lcd_scroll_off(void);
+
+void lcd_compositor_begin(void);
+void lcd_compositor_end(void);
+void lcd_flush(void);
+
+void lcd_region_begin(ILI9341_Region* region);
+void lcd_region_end(void);
+
+void lcd_queue_begin(uint8_t policy);
+void lcd_queue_end(void);
+void lcd_queue_get_stats(ILI9341_Queue_Stats* stats);
 
 
 
@@ -4,14 +4,24 @@
  * @author      Dimitry Ntofeu Nyatcha
  * @version     v1.0
  * @date        20.04.2025
- * @brief       Modul für unsere eigene LCD-Funktionen (Balkendiagramm, Kreuz)
+ * @brief       Modul für unsere eigene LCD-Funktionen (Balkendiagramm, Rollkurve, Linienschreiber, Zeigerinstrument, Kreuz)
  @verbatim
  ==================================================
             ### Verwendete Ressourcen ###
     LCD: ILI9341 Controller aslo: ILI9341_Draw_Filled_Rectangle_Coord()
+         Hardware-Scrolling des ILI9341 für die Rollkurve (lcd_set_scroll_area(), lcd_scroll())
  ==================================================
             ###     Verwendung      ###
     (#) Aufruf von 'my_lcd_draw_baargraph()', um ein horizontales Balkendiagramm zu zeichnen.
+    (#) Für zyklisch aktualisierte Balken 'my_lcd_bargraph_init()' einmal und dann
+        'my_lcd_bargraph_update()' aufrufen, es wird nur der geänderte Streifen gezeichnet.
+    (#) Für Verläufe 'my_lcd_rollchart_init()' einmal und dann pro Messwert
+        'my_lcd_rollchart_add()' aufrufen, es wird nur eine Zeile gezeichnet und
+        der Rest vom Display weitergerollt.
+    (#) Für Zeitverläufe in einem Rechteck 'my_lcd_stripchart_init()' einmal und dann
+        pro Messwert 'my_lcd_stripchart_add()' aufrufen, es wird nur eine Spalte gezeichnet.
+    (#) Für Zeigerinstrumente 'my_lcd_dial_init()' einmal und dann 'my_lcd_dial_update()'
+        aufrufen, die Skala wird nur einmal gezeichnet, danach nur die alte und die neue Nadel.
     (#) Aufruf von 'draw_diag_cross()', um ein diagonales Kreuz auf das Display zu zeichnen.
  ==================================================
  @endverbatim
@@ -46,6 +56,530 @@ void my_lcd_draw_baargraph(uint16_t x, uint16_t y, uint16_t width,uint16_t heigh
 
 }
 
+/**
+ * @brief  Legt ein Balkendiagramm an, gezeichnet wird erst beim ersten Update
+ * @param  bar       Balkendiagramm
+ * @param  x         Startposition x
+ * @param  y         Startposition y (untere Kante wie bei my_lcd_draw_baargraph)
+ * @param  width     Breite des gesamten Balkens
+ * @param  height    Höhe des Balkens
+ * @param  color     Füllfarbe des aktiven Bereichs
+ * @param  bg_color  Hintergrundfarbe des inaktiven Bereichs
+ * @return Keine
+ */
+void my_lcd_bargraph_init(my_lcd_bargraph_t *bar, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color, uint16_t bg_color){
+
+	bar->x = x;
+	bar->y = y;
+	bar->width = width;
+	bar->height = height;
+	bar->color = color;
+	bar->bg_color = bg_color;
+	bar->fill = -1;
+}
+
+/**
+ * @brief  Aktualisiert ein Balkendiagramm, gleiches Bild wie my_lcd_draw_baargraph
+ *
+ * Nur der Streifen zwischen alter und neuer Füllbreite wird neu gezeichnet,
+ * die Kosten hängen also von der Änderung ab und nicht von der Balkengröße.
+ * @param  bar    Balkendiagramm
+ * @param  value  Wert zwischen 0 und 1000 (Promille)
+ * @return Keine
+ */
+void my_lcd_bargraph_update(my_lcd_bargraph_t *bar, uint16_t value){
+
+	if (value > 1000){value = 1000;}
+
+	int16_t fill = (bar->width * value) / 1000;
+	uint16_t top = bar->y - bar->height;
+
+	if (bar->fill < 0){
+		// erstes Zeichnen: ganzer Balken
+		my_lcd_draw_baargraph(bar->x, bar->y, bar->width, bar->height, value, bar->color, bar->bg_color);
+	}
+	else if (fill > bar->fill){
+		// Streifen wechselt von Füllfarbe zu Hintergrundfarbe
+		ILI9341_Draw_Filled_Rectangle_Coord(bar->x + bar->fill, top, bar->x + fill, bar->y, bar->bg_color);
+	}
+	else if (fill < bar->fill){
+		ILI9341_Draw_Filled_Rectangle_Coord(bar->x + fill, top, bar->x + bar->fill, bar->y, bar->color);
+	}
+
+	bar->fill = fill;
+}
+
+/**
+ * @brief  Vergisst den gezeichneten Zustand, z.B. nachdem der Bereich übermalt wurde.
+ *         Das nächste Update zeichnet den ganzen Balken.
+ * @param  bar  Balkendiagramm
+ * @return Keine
+ */
+void my_lcd_bargraph_invalidate(my_lcd_bargraph_t *bar){
+
+	bar->fill = -1;
+}
+
+/**
+ * @brief  Legt eine Rollkurve an, richtet den Scrollbereich ein und löscht ihn
+ *
+ * Der Scrollbereich geht immer über die ganze Bildschirmbreite (hochkant) bzw.
+ * -höhe (quer), daneben kann nichts anderes gezeichnet werden.
+ * Die Ausrichtung muss vorher eingestellt sein.
+ * @param  chart     Rollkurve
+ * @param  start     erste Zeile (hochkant) bzw. Spalte (quer) des Bereichs
+ * @param  length    Anzahl Zeilen bzw. Spalten, so viele Messwerte sind sichtbar
+ * @param  bg_color  Hintergrundfarbe
+ * @param  colors    Farbe je Kurve
+ * @param  traces    Anzahl Kurven, höchstens MY_LCD_ROLLCHART_MAX_TRACES
+ * @return Keine
+ */
+void my_lcd_rollchart_init(my_lcd_rollchart_t *chart, uint16_t start, uint16_t length, uint16_t bg_color, const uint16_t *colors, uint8_t traces){
+
+	if (traces > MY_LCD_ROLLCHART_MAX_TRACES){traces = MY_LCD_ROLLCHART_MAX_TRACES;}
+
+	chart->start = start;
+	chart->length = length;
+	chart->bg_color = bg_color;
+	chart->offset = 0;
+	chart->traces = traces;
+	for (uint8_t i = 0; i < traces; i++){
+		chart->colors[i] = colors[i];
+		chart->last[i] = -1;
+	}
+
+	lcd_set_scroll_area(start, length);
+	if (LCD_HEIGHT > LCD_WIDTH){
+		ILI9341_Draw_Filled_Rectangle_Coord(0, start, LCD_WIDTH, start + length, bg_color);
+	}
+	else{
+		ILI9341_Draw_Filled_Rectangle_Coord(start, 0, start + length, LCD_HEIGHT, bg_color);
+	}
+}
+
+/**
+ * @brief  Hängt einen Messwert je Kurve an die Rollkurve an
+ *
+ * Überschrieben wird die älteste Zeile (hochkant) bzw. Spalte (quer): eine Linie
+ * in Hintergrundfarbe und je Kurve eine Linie von der letzten zur neuen Position.
+ * Danach rückt der Scroll-Zeiger um eins weiter, die neue Zeile erscheint am Ende
+ * des Bereichs. Der übrige Verlauf wird nicht neu gezeichnet.
+ * @param  chart   Rollkurve
+ * @param  values  ein Wert je Kurve zwischen 0 und 1000 (Promille)
+ * @return Keine
+ */
+void my_lcd_rollchart_add(my_lcd_rollchart_t *chart, const uint16_t *values){
+
+	uint8_t hochkant = (LCD_HEIGHT > LCD_WIDTH);
+	uint16_t line = chart->start + chart->offset;
+	uint16_t across = hochkant ? LCD_WIDTH : LCD_HEIGHT;
+
+	if (hochkant){
+		lcd_draw_horizontal_line(0, line, across, chart->bg_color);
+	}
+	else{
+		lcd_draw_vertical_line(line, 0, across, chart->bg_color);
+	}
+
+	for (uint8_t i = 0; i < chart->traces; i++){
+		uint16_t value = (values[i] > 1000) ? 1000 : values[i];
+		int16_t pos = ((across - 1) * value) / 1000;
+		if (!hochkant){pos = across - 1 - pos;} // quer wachsen die Werte nach oben
+
+		// Verbindung zur letzten Position, damit die Kurve keine Lücken hat
+		int16_t from = (chart->last[i] < 0) ? pos : chart->last[i];
+		int16_t low = (from < pos) ? from : pos;
+		int16_t high = (from < pos) ? pos : from;
+
+		if (hochkant){
+			lcd_draw_horizontal_line(low, line, high - low + 1, chart->colors[i]);
+		}
+		else{
+			lcd_draw_vertical_line(line, low, high - low + 1, chart->colors[i]);
+		}
+		chart->last[i] = pos;
+	}
+
+	chart->offset = (chart->offset + 1) % chart->length;
+	lcd_scroll(chart->offset);
+}
+
+/**
+ * @brief  Rechnet einen Wert in die Bildschirmzeile des Linienschreibers um
+ * @param  chart  Linienschreiber
+ * @param  value  Messwert
+ * @return Zeile innerhalb des Rechtecks, 0 = oben
+ */
+static uint16_t my_lcd_stripchart_row(const my_lcd_stripchart_t *chart, int32_t value){
+
+	if (value <= chart->scale_min){return chart->height - 1;}
+	if (value >= chart->scale_max){return 0;}
+
+	int64_t pos = (int64_t)(value - chart->scale_min) * (chart->height - 1) / (chart->scale_max - chart->scale_min);
+	return chart->height - 1 - (uint16_t)pos;
+}
+
+/**
+ * @brief  Zeichnet eine Spalte neu: Hintergrund und Linie vom vorigen zum eigenen Wert
+ * @param  chart   Linienschreiber
+ * @param  column  Spalte
+ * @param  erase   1 = Spalte vorher mit der Hintergrundfarbe löschen
+ * @return Keine
+ */
+static void my_lcd_stripchart_column(const my_lcd_stripchart_t *chart, uint16_t column, uint8_t erase){
+
+	uint16_t row = my_lcd_stripchart_row(chart, chart->samples[column]);
+	uint16_t from = row;
+
+	// Vorgänger ist die Spalte links davon, die älteste Spalte hat keinen
+	uint16_t oldest = (chart->count < chart->width) ? 0 : chart->next;
+	if (column != oldest){
+		uint16_t prev = (column == 0) ? chart->width - 1 : column - 1;
+		from = my_lcd_stripchart_row(chart, chart->samples[prev]);
+	}
+
+	uint16_t low = (from < row) ? from : row;
+	uint16_t high = (from < row) ? row : from;
+
+	if (erase){
+		lcd_draw_vertical_line(chart->x + column, chart->y, chart->height, chart->bg_color);
+	}
+	lcd_draw_vertical_line(chart->x + column, chart->y + low, high - low + 1, chart->color);
+}
+
+/**
+ * @brief  Passt die Skala an die gespeicherten Werte an, mit 25 % Luft nach oben und unten.
+ *         Beim Erweitern wird die Skala mindestens verdoppelt, damit ein langsam
+ *         weglaufender Wert nicht bei jedem Messwert ein neues Bild kostet.
+ * @param  chart  Linienschreiber
+ * @param  value  neuer Wert, der noch nicht im Ring steht
+ * @param  grow   1 = Skala wird erweitert, 0 = Skala wird verkleinert
+ * @return Keine
+ */
+static void my_lcd_stripchart_rescale(my_lcd_stripchart_t *chart, int32_t value, uint8_t grow){
+
+	int32_t low = value;
+	int32_t high = value;
+	for (uint16_t i = 0; i < chart->count; i++){
+		if (chart->samples[i] < low){low = chart->samples[i];}
+		if (chart->samples[i] > high){high = chart->samples[i];}
+	}
+
+	int32_t margin = (high - low) / 4;
+	int32_t span = chart->scale_max - chart->scale_min;
+	if (grow && chart->count > 0 && (high - low) + 2 * margin < 2 * span){
+		margin = (2 * span - (high - low)) / 2;
+	}
+	if (margin < 1){margin = 1;}
+	chart->scale_min = low - margin;
+	chart->scale_max = high + margin;
+}
+
+/**
+ * @brief  Legt einen Linienschreiber an und zeichnet ihn leer
+ * @param  chart      Linienschreiber
+ * @param  x          linke Kante
+ * @param  y          obere Kante
+ * @param  width      Breite in Pixel = Anzahl sichtbarer Werte, höchstens MY_LCD_STRIPCHART_MAX_SAMPLES
+ * @param  height     Höhe in Pixel
+ * @param  color      Linienfarbe
+ * @param  bg_color   Hintergrundfarbe
+ * @param  min        Wert am unteren Rand
+ * @param  max        Wert am oberen Rand
+ * @param  autoscale  1 = Skala folgt den Werten, min und max sind nur der Startwert
+ * @return Keine
+ */
+void my_lcd_stripchart_init(my_lcd_stripchart_t *chart, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color, uint16_t bg_color, int32_t min, int32_t max, uint8_t autoscale){
+
+	if (width > MY_LCD_STRIPCHART_MAX_SAMPLES){width = MY_LCD_STRIPCHART_MAX_SAMPLES;}
+	if (max <= min){max = min + 1;}
+
+	chart->x = x;
+	chart->y = y;
+	chart->width = width;
+	chart->height = height;
+	chart->color = color;
+	chart->bg_color = bg_color;
+	chart->autoscale = autoscale;
+	chart->scale_min = min;
+	chart->scale_max = max;
+
+	my_lcd_stripchart_clear(chart);
+}
+
+/**
+ * @brief  Hängt einen Messwert an
+ *
+ * Normalfall: die älteste Spalte wird mit einer Linie in Hintergrundfarbe gelöscht
+ * und mit einer Linie vom vorigen zum neuen Wert neu gezeichnet.
+ * Mit Autoskalierung wird die Skala sofort erweitert, wenn der Wert herausfällt,
+ * und erst verkleinert, wenn alle Werte eines Durchlaufs weniger als ein Viertel
+ * der Skala belegen. Nur dann wird der ganze Linienschreiber neu gezeichnet.
+ * @param  chart  Linienschreiber
+ * @param  value  Messwert
+ * @return Keine
+ */
+void my_lcd_stripchart_add(my_lcd_stripchart_t *chart, int32_t value){
+
+	uint8_t rescale = 0;
+	uint8_t grow = 0;
+
+	if (chart->autoscale){
+		if (chart->count == 0 || value < chart->scale_min || value > chart->scale_max){
+			rescale = 1;
+			grow = 1;
+		}
+		else if (chart->next == 0 && chart->count == chart->width){
+			// einmal pro Durchlauf prüfen, ob die Skala zu groß geworden ist
+			int32_t low = value;
+			int32_t high = value;
+			for (uint16_t i = 0; i < chart->count; i++){
+				if (chart->samples[i] < low){low = chart->samples[i];}
+				if (chart->samples[i] > high){high = chart->samples[i];}
+			}
+			rescale = ((high - low) < (chart->scale_max - chart->scale_min) / 4);
+		}
+	}
+
+	uint16_t column = chart->next;
+	if (rescale){
+		my_lcd_stripchart_rescale(chart, value, grow);
+	}
+
+	chart->samples[column] = value;
+	chart->next = (column + 1) % chart->width;
+	if (chart->count < chart->width){chart->count++;}
+
+	if (rescale){
+		my_lcd_stripchart_redraw(chart);
+	}
+	else{
+		my_lcd_stripchart_column(chart, column, 1);
+	}
+}
+
+/**
+ * @brief  Verwirft alle Werte und zeichnet den Linienschreiber leer,
+ *         z.B. wenn eine andere Messgröße angezeigt wird
+ * @param  chart  Linienschreiber
+ * @return Keine
+ */
+void my_lcd_stripchart_clear(my_lcd_stripchart_t *chart){
+
+	chart->count = 0;
+	chart->next = 0;
+	ILI9341_Draw_Filled_Rectangle_Coord(chart->x, chart->y, chart->x + chart->width, chart->y + chart->height, chart->bg_color);
+}
+
+/**
+ * @brief  Zeichnet den ganzen Linienschreiber neu, z.B. nachdem der Bereich übermalt wurde
+ * @param  chart  Linienschreiber
+ * @return Keine
+ */
+void my_lcd_stripchart_redraw(my_lcd_stripchart_t *chart){
+
+	ILI9341_Draw_Filled_Rectangle_Coord(chart->x, chart->y, chart->x + chart->width, chart->y + chart->height, chart->bg_color);
+	for (uint16_t i = 0; i < chart->count; i++){
+		my_lcd_stripchart_column(chart, i, 0);
+	}
+}
+
+/**
+ * @brief  Viertelperiode des Sinus in Schritten von 1 Grad, 16384 = 1.0.
+ *         Der Zeiger wird damit ohne sinf/cosf und ohne Gleitkomma berechnet.
+ */
+static const int16_t my_lcd_sin_table[91] = {
+	0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+	2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+	5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+	8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+	10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+	12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+	14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+	15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+	16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+	16384
+};
+
+/**
+ * @brief  Sinus aus der Tabelle
+ * @param  angle  Winkel in Grad, beliebig groß oder negativ
+ * @return Sinus, 16384 = 1.0
+ */
+static int32_t my_lcd_sin(int32_t angle){
+
+	angle %= 360;
+	if (angle < 0){angle += 360;}
+
+	if (angle <= 90){return my_lcd_sin_table[angle];}
+	if (angle <= 180){return my_lcd_sin_table[180 - angle];}
+	if (angle <= 270){return -my_lcd_sin_table[angle - 180];}
+	return -my_lcd_sin_table[360 - angle];
+}
+
+/**
+ * @brief  Rechnet einen Punkt auf einem Strahl des Zeigerinstruments aus
+ * @param  dial    Zeigerinstrument
+ * @param  angle   Winkel in Grad ab start_angle
+ * @param  length  Abstand vom Mittelpunkt in Pixel
+ * @param  x       Ergebnis x
+ * @param  y       Ergebnis y
+ * @return Keine
+ */
+static void my_lcd_dial_point(const my_lcd_dial_t *dial, int32_t angle, uint16_t length, int16_t *x, int16_t *y){
+
+	angle += dial->start_angle;
+	// 0 Grad zeigt nach oben, die Bildschirmzeilen zählen nach unten
+	*x = dial->cx + ((length * my_lcd_sin(angle) + 8192) >> 14);
+	*y = dial->cy - ((length * my_lcd_sin(angle + 90) + 8192) >> 14);
+}
+
+/**
+ * @brief  Länge der Skalenstriche
+ * @param  dial  Zeigerinstrument
+ * @return Länge in Pixel
+ */
+static uint16_t my_lcd_dial_tick_length(const my_lcd_dial_t *dial){
+
+	return (dial->radius < 24) ? 3 : dial->radius / 8;
+}
+
+/**
+ * @brief  Radius der Nabe, die Nadel beginnt mit etwas Abstand davor
+ * @param  dial  Zeigerinstrument
+ * @return Radius in Pixel
+ */
+static uint16_t my_lcd_dial_hub(const my_lcd_dial_t *dial){
+
+	return dial->radius / 16 + 2;
+}
+
+/**
+ * @brief  Zeichnet die Nadel
+ * @param  dial   Zeigerinstrument
+ * @param  angle  Winkel in Grad ab start_angle
+ * @param  color  Farbe, Hintergrundfarbe zum Löschen
+ * @return Keine
+ */
+static void my_lcd_dial_needle(const my_lcd_dial_t *dial, int16_t angle, uint16_t color){
+
+	int16_t x0, y0, x1, y1;
+	my_lcd_dial_point(dial, angle, my_lcd_dial_hub(dial) + 2, &x0, &y0);
+	my_lcd_dial_point(dial, angle, dial->needle, &x1, &y1);
+	lcd_draw_line(x0, y0, x1, y1, color);
+}
+
+/**
+ * @brief  Zeichnet die Skala: Hintergrund, Rand, Skalenstriche und Nabe
+ * @param  dial  Zeigerinstrument
+ * @return Keine
+ */
+static void my_lcd_dial_face(my_lcd_dial_t *dial){
+
+	uint16_t outer = dial->radius - 2;
+	uint16_t inner = outer - my_lcd_dial_tick_length(dial);
+
+	lcd_draw_circle(dial->cx, dial->cy, dial->radius, dial->bg_color, 1);
+	lcd_draw_circle(dial->cx, dial->cy, dial->radius, dial->color, 0);
+
+	for (uint16_t i = 0; i <= dial->ticks; i++){
+		int32_t angle = (int32_t)dial->sweep * i / dial->ticks;
+		int16_t x0, y0, x1, y1;
+		my_lcd_dial_point(dial, angle, inner, &x0, &y0);
+		my_lcd_dial_point(dial, angle, outer, &x1, &y1);
+		lcd_draw_line(x0, y0, x1, y1, dial->color);
+	}
+
+	lcd_draw_circle(dial->cx, dial->cy, my_lcd_dial_hub(dial), dial->color, 1);
+
+	dial->face = 1;
+	dial->angle = -1;
+}
+
+/**
+ * @brief  Legt ein Zeigerinstrument an und zeichnet die Skala ohne Nadel
+ *
+ * Die Nadel bleibt innerhalb der Skalenstriche und außerhalb der Nabe, sie
+ * überdeckt also nur Hintergrund. Innerhalb des Kreises sollte nichts anderes
+ * gezeichnet werden, das Löschen der Nadel würde es übermalen.
+ * @param  dial          Zeigerinstrument
+ * @param  cx            Mittelpunkt x
+ * @param  cy            Mittelpunkt y
+ * @param  radius        Außenradius, mindestens 16
+ * @param  start_angle   Winkel beim Minimum in Grad, 0 = oben, z.B. -135
+ * @param  sweep         Skalenbereich in Grad im Uhrzeigersinn, z.B. 270, höchstens 360
+ * @param  min           Wert beim Anfang der Skala
+ * @param  max           Wert beim Ende der Skala
+ * @param  ticks         Anzahl Skalenabschnitte, gezeichnet werden ticks + 1 Striche
+ * @param  color         Farbe von Rand, Strichen und Nabe
+ * @param  needle_color  Farbe der Nadel
+ * @param  bg_color      Hintergrundfarbe
+ * @return Keine
+ */
+void my_lcd_dial_init(my_lcd_dial_t *dial, uint16_t cx, uint16_t cy, uint16_t radius, int16_t start_angle, uint16_t sweep, int32_t min, int32_t max, uint8_t ticks, uint16_t color, uint16_t needle_color, uint16_t bg_color){
+
+	if (radius < 16){radius = 16;}
+	if (sweep > 360){sweep = 360;}
+	if (max <= min){max = min + 1;}
+	if (ticks == 0){ticks = 1;}
+
+	dial->cx = cx;
+	dial->cy = cy;
+	dial->radius = radius;
+	dial->needle = radius - 2 - my_lcd_dial_tick_length(dial) - 2;
+	dial->start_angle = start_angle;
+	dial->sweep = sweep;
+	dial->min = min;
+	dial->max = max;
+	dial->ticks = ticks;
+	dial->color = color;
+	dial->needle_color = needle_color;
+	dial->bg_color = bg_color;
+
+	my_lcd_dial_face(dial);
+}
+
+/**
+ * @brief  Stellt die Nadel auf einen Wert
+ *
+ * Die Nadel steht in ganzen Grad. Ändert sich der Winkel nicht, wird nichts
+ * gezeichnet, sonst wird die alte Nadel mit der Hintergrundfarbe übermalt und
+ * die neue gezeichnet, je eine Linie. Die Skala bleibt stehen.
+ * @param  dial   Zeigerinstrument
+ * @param  value  Messwert, außerhalb von min und max steht die Nadel am Anschlag
+ * @return Keine
+ */
+void my_lcd_dial_update(my_lcd_dial_t *dial, int32_t value){
+
+	if (value < dial->min){value = dial->min;}
+	if (value > dial->max){value = dial->max;}
+
+	int16_t angle = (int64_t)(value - dial->min) * dial->sweep / (dial->max - dial->min);
+
+	if (!dial->face){
+		my_lcd_dial_face(dial);
+	}
+	if (angle == dial->angle){return;}
+
+	if (dial->angle >= 0){
+		my_lcd_dial_needle(dial, dial->angle, dial->bg_color);
+	}
+	my_lcd_dial_needle(dial, angle, dial->needle_color);
+	dial->angle = angle;
+}
+
+/**
+ * @brief  Vergisst den gezeichneten Zustand, z.B. nachdem der Bereich übermalt wurde.
+ *         Das nächste Update zeichnet Skala und Nadel neu.
+ * @param  dial  Zeigerinstrument
+ * @return Keine
+ */
+void my_lcd_dial_invalidate(my_lcd_dial_t *dial){
+
+	dial->face = 0;
+	dial->angle = -1;
+}
+
 /**
  * @brief  Zeichnet ein diagonales Kreuz auf das Display
  * @param  x     Startposition x
@@ -54,10 +588,8 @@ void my_lcd_draw_baargraph(uint16_t x, uint16_t y, uint16_t width,uint16_t heigh
  * @return Keine
  */
 void draw_diag_cross(uint16_t x, uint16_t y, uint16_t color){
-for (int i = 0; i < 100; i++){
-	 lcd_draw_pixel( x + 50 , y + i, color);
-	 lcd_draw_pixel( x + i , y + 50, color);
-}
+	lcd_draw_vertical_line(x + 50, y, 100, color);
+	lcd_draw_horizontal_line(x, y + 50, 100, color);
 }
 
 
@@ -4,14 +4,111 @@
  * @author      Dimitry Ntofeu Nyatcha
  * @version     v1.0
  * @date        20.04.2025
- * @brief       Header-Datei für das LCD-Hilfsmodul (Balkendiagramm und Kreuz)
+ * @brief       Header-Datei für das LCD-Hilfsmodul (Balkendiagramm, Rollkurve, Linienschreiber, Zeigerinstrument und Kreuz)
  **************************************************
  */
 
 #ifndef MY_LCD_MY_LCD_H_
 #define MY_LCD_MY_LCD_H_
 
+#include "stm32f4xx.h"
+
+/**
+ * @brief Balkendiagramm mit Zustand, merkt sich die zuletzt gezeichnete Füllbreite
+ */
+typedef struct {
+	uint16_t x;
+	uint16_t y;
+	uint16_t width;
+	uint16_t height;
+	uint16_t color;
+	uint16_t bg_color;
+	int16_t fill; // zuletzt gezeichnete Füllbreite in Pixel, -1 = noch nichts gezeichnet
+} my_lcd_bargraph_t;
+
+/**
+ * @brief Maximale Anzahl Kurven in einer Rollkurve
+ */
+#define MY_LCD_ROLLCHART_MAX_TRACES	3
+
+/**
+ * @brief Rollende Kurve im Hardware-Scrollbereich des Displays.
+ *        Jeder Messwert belegt eine Zeile (hochkant) bzw. Spalte (quer),
+ *        weitergerollt wird über den Scroll-Zeiger des Displays.
+ */
+typedef struct {
+	uint16_t start;   // erste Zeile/Spalte des Bereichs
+	uint16_t length;  // Anzahl Zeilen/Spalten = sichtbare Messwerte
+	uint16_t bg_color;
+	uint16_t offset;  // aktueller Scroll-Offset, zugleich die nächste zu beschreibende Zeile
+	uint8_t traces;
+	uint16_t colors[MY_LCD_ROLLCHART_MAX_TRACES];
+	int16_t last[MY_LCD_ROLLCHART_MAX_TRACES]; // letzte Position je Kurve, -1 = noch kein Wert
+} my_lcd_rollchart_t;
+
+/**
+ * @brief Maximale Anzahl Messwerte (= Breite in Pixel) eines Linienschreibers
+ */
+#define MY_LCD_STRIPCHART_MAX_SAMPLES	240
+
+/**
+ * @brief Linienschreiber: Zeitverlauf in einem Rechteck, jede Spalte ist ein Messwert.
+ *        Der neue Wert überschreibt die älteste Spalte, der Schreibzeiger läuft
+ *        von links nach rechts und beginnt dann wieder links.
+ */
+typedef struct {
+	uint16_t x;
+	uint16_t y;
+	uint16_t width;   // Anzahl Spalten = Anzahl Messwerte im Ring
+	uint16_t height;
+	uint16_t color;
+	uint16_t bg_color;
+	uint8_t autoscale;
+	int32_t scale_min;  // Wert am unteren Rand
+	int32_t scale_max;  // Wert am oberen Rand
+	uint16_t count;     // Anzahl gespeicherter Werte
+	uint16_t next;      // Spalte für den nächsten Wert
+	int32_t samples[MY_LCD_STRIPCHART_MAX_SAMPLES]; // Ring, Index = Spalte
+} my_lcd_stripchart_t;
+
+/**
+ * @brief Zeigerinstrument: Skala wird einmal gezeichnet, danach nur noch die Nadel.
+ *        Winkel in Grad, 0 = oben, positiv im Uhrzeigersinn.
+ */
+typedef struct {
+	uint16_t cx;
+	uint16_t cy;
+	uint16_t radius;      // Außenradius der Skala
+	uint16_t needle;      // Nadellänge, endet innerhalb der Skalenstriche
+	int16_t start_angle;  // Winkel beim Minimum
+	uint16_t sweep;       // Skalenbereich in Grad
+	int32_t min;
+	int32_t max;
+	uint8_t ticks;        // Anzahl Skalenabschnitte
+	uint16_t color;       // Skala und Nabe
+	uint16_t needle_color;
+	uint16_t bg_color;
+	uint8_t face;         // 1 = Skala ist gezeichnet
+	int16_t angle;        // zuletzt gezeichnete Nadel in Grad ab start_angle, -1 = keine Nadel
+} my_lcd_dial_t;
+
 void my_lcd_draw_baargraph(uint16_t x, uint16_t y, uint16_t width,uint16_t height, uint16_t value, uint16_t Colour, uint16_t bg_colour);
 
+void my_lcd_bargraph_init(my_lcd_bargraph_t *bar, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color, uint16_t bg_color);
+void my_lcd_bargraph_update(my_lcd_bargraph_t *bar, uint16_t value);
+void my_lcd_bargraph_invalidate(my_lcd_bargraph_t *bar);
+
+void my_lcd_rollchart_init(my_lcd_rollchart_t *chart, uint16_t start, uint16_t length, uint16_t bg_color, const uint16_t *colors, uint8_t traces);
+void my_lcd_rollchart_add(my_lcd_rollchart_t *chart, const uint16_t *values);
+
+void my_lcd_stripchart_init(my_lcd_stripchart_t *chart, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color, uint16_t bg_color, int32_t min, int32_t max, uint8_t autoscale);
+void my_lcd_stripchart_add(my_lcd_stripchart_t *chart, int32_t value);
+void my_lcd_stripchart_clear(my_lcd_stripchart_t *chart);
+void my_lcd_stripchart_redraw(my_lcd_stripchart_t *chart);
+
+void my_lcd_dial_init(my_lcd_dial_t *dial, uint16_t cx, uint16_t cy, uint16_t radius, int16_t start_angle, uint16_t sweep, int32_t min, int32_t max, uint8_t ticks, uint16_t color, uint16_t needle_color, uint16_t bg_color);
+void my_lcd_dial_update(my_lcd_dial_t *dial, int32_t value);
+void my_lcd_dial_invalidate(my_lcd_dial_t *dial);
+
 void draw_diag_cross(uint16_t x, uint16_t y, uint16_t color);
 #endif /* MY_LCD_MY_LCD_H_ */
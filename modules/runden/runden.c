@@ -0,0 +1,240 @@
+/**
+ **************************************************
+ * @file        runden.c
+ * @brief       Rundenspeicher der Stoppuhr ohne feste Obergrenze
+ @verbatim
+ ==================================================
+            ### Verwendete Ressourcen ###
+    RAM-Ring für die letzten RUNDEN_RAM_ANZAHL Runden,
+    Backup-SRAM (4 KB ab BKPSRAM_BASE) als Log, wenn RUNDEN_BKPSRAM_LOG 1 ist
+ ==================================================
+            ###     Verwendung      ###
+    (#) Aufruf von 'runden_init()' einmal beim Start, schaltet das Backup-SRAM ein.
+    (#) Aufruf von 'runden_loeschen()' beim Start einer neuen Messung.
+    (#) Aufruf von 'runden_hinzufuegen()' mit jeder abgeschlossenen Rundenzeit.
+        Statistik (beste, schlechteste, Mittelwert, Varianz, Delta) wird dabei in O(1) nachgeführt.
+    (#) Aufruf von 'runden_holen()', um eine Runde für die Anzeige zu lesen.
+        Die letzten RUNDEN_RAM_ANZAHL Runden kommen aus dem RAM, ältere aus dem Log.
+        Runden, die weder im Ring noch im Log stehen, liefern 0; die Statistik zählt sie trotzdem.
+ ==================================================
+ @endverbatim
+ **************************************************
+ */
+
+#include "runden.h"
+
+#define RUNDEN_RAM_MASKE    (RUNDEN_RAM_ANZAHL - 1)
+
+/**
+ * Log im Backup-SRAM: Anzahl der geschriebenen Runden, danach die Rundenzeiten der Reihe nach
+ */
+#define RUNDEN_LOG_ANZAHL   ((4096 - 8) / 8)
+
+typedef struct {
+    uint32_t anzahl;
+    uint32_t reserviert;
+    uint64_t zeit_us[RUNDEN_LOG_ANZAHL];
+} runden_log_t;
+
+#define RUNDEN_LOG          ((volatile runden_log_t*)BKPSRAM_BASE)
+
+/**
+ * Private variablen
+ */
+static uint64_t ring_zeit_us[RUNDEN_RAM_ANZAHL]; // Rundenzeiten der letzten Runden
+static int64_t ring_delta_us[RUNDEN_RAM_ANZAHL]; // Delta zur jeweils vorherigen Runde
+static runden_statistik_t statistik;
+
+/**
+ * @brief Schaltet das Backup-SRAM für das Log ein und löscht alle Runden
+ * @param None
+ * @retval None
+ */
+void runden_init(void) {
+#if RUNDEN_BKPSRAM_LOG
+    __HAL_RCC_PWR_CLK_ENABLE();
+    HAL_PWR_EnableBkUpAccess(); // Schreibschutz des Backup-Bereichs aufheben
+    __HAL_RCC_BKPSRAM_CLK_ENABLE();
+#endif
+    runden_loeschen();
+}
+
+/**
+ * @brief Löscht alle Runden und die Statistik
+ * @param None
+ * @retval None
+ */
+void runden_loeschen(void) {
+    statistik.anzahl = 0;
+    statistik.beste_us = 0;
+    statistik.beste_nummer = 0;
+    statistik.schlechteste_us = 0;
+    statistik.schlechteste_nummer = 0;
+    statistik.summe_us = 0;
+    statistik.erste_us = 0;
+    statistik.abweichung_ms = 0;
+    statistik.quadrate_ms2 = 0;
+    statistik.delta_us = 0;
+#if RUNDEN_BKPSRAM_LOG
+    RUNDEN_LOG->anzahl = 0;
+#endif
+}
+
+/**
+ * @brief Speichert eine abgeschlossene Runde und führt die Statistik nach
+ *
+ * Der Aufwand ist unabhängig von der Anzahl der Runden: der Ring überschreibt die älteste
+ * Runde, für Mittelwert und Varianz werden nur Summen fortgeschrieben. Die Varianz rechnet
+ * ganzzahlig mit den Abweichungen von der ersten Runde in ms, ohne double, das auf dem
+ * Cortex-M4F in Software liefe.
+ * @param zeit_us Rundenzeit in µs
+ * @retval None
+ */
+void runden_hinzufuegen(uint64_t zeit_us) {
+    uint32_t nummer = statistik.anzahl;
+    int64_t delta_us = 0;
+
+    if (nummer == 0) {
+        statistik.beste_us = zeit_us;
+        statistik.schlechteste_us = zeit_us;
+        statistik.erste_us = zeit_us;
+    } else {
+        delta_us = (int64_t)(zeit_us - ring_zeit_us[(nummer - 1) & RUNDEN_RAM_MASKE]);
+        if (zeit_us < statistik.beste_us) {
+            statistik.beste_us = zeit_us;
+            statistik.beste_nummer = nummer;
+        }
+        if (zeit_us > statistik.schlechteste_us) {
+            statistik.schlechteste_us = zeit_us;
+            statistik.schlechteste_nummer = nummer;
+        }
+    }
+
+    ring_zeit_us[nummer & RUNDEN_RAM_MASKE] = zeit_us;
+    ring_delta_us[nummer & RUNDEN_RAM_MASKE] = delta_us;
+
+#if RUNDEN_BKPSRAM_LOG
+    if (nummer < RUNDEN_LOG_ANZAHL) {
+        RUNDEN_LOG->zeit_us[nummer] = zeit_us;
+        RUNDEN_LOG->anzahl = nummer + 1;
+    }
+#endif
+
+    statistik.anzahl = nummer + 1;
+    statistik.summe_us += zeit_us;
+    statistik.delta_us = delta_us;
+
+    // auf ms gerundet passt das Quadrat auch für Runden, die Stunden von der ersten abweichen
+    int64_t abweichung_us = (int64_t)(zeit_us - statistik.erste_us);
+    int64_t abweichung_ms = (abweichung_us + ((abweichung_us < 0) ? -500 : 500)) / 1000;
+    statistik.abweichung_ms += abweichung_ms;
+    statistik.quadrate_ms2 += (uint64_t)(abweichung_ms * abweichung_ms);
+}
+
+/**
+ * @brief Anzahl der Runden seit runden_loeschen()
+ * @param None
+ * @retval Anzahl der Runden
+ */
+uint32_t runden_anzahl(void) {
+    return statistik.anzahl;
+}
+
+/**
+ * @brief Liest eine Runde aus dem RAM-Ring oder, wenn sie dort schon überschrieben ist, aus dem Log
+ * @param nummer Nummer der Runde, 0 = erste Runde
+ * @param runde Zielstruktur
+ * @retval 1 wenn die Runde gespeichert ist, sonst 0
+ */
+uint8_t runden_holen(uint32_t nummer, runde_t* runde) {
+    if (nummer >= statistik.anzahl) {
+        return 0;
+    }
+
+    runde->nummer = nummer;
+    if (statistik.anzahl - nummer <= RUNDEN_RAM_ANZAHL) {
+        runde->zeit_us = ring_zeit_us[nummer & RUNDEN_RAM_MASKE];
+        runde->delta_us = ring_delta_us[nummer & RUNDEN_RAM_MASKE];
+        return 1;
+    }
+
+#if RUNDEN_BKPSRAM_LOG
+    if (nummer < RUNDEN_LOG->anzahl) {
+        runde->zeit_us = RUNDEN_LOG->zeit_us[nummer];
+        runde->delta_us = nummer ? (int64_t)(runde->zeit_us - RUNDEN_LOG->zeit_us[nummer - 1]) : 0;
+        return 1;
+    }
+#endif
+    return 0;
+}
+
+/**
+ * @brief Statistik über alle Runden
+ * @param None
+ * @retval Zeiger auf die Statistik, gültig bis zur nächsten Runde
+ */
+const runden_statistik_t* runden_statistik(void) {
+    return &statistik;
+}
+
+/**
+ * @brief Mittlere Rundenzeit, exakt aus der Summe
+ * @param None
+ * @retval Mittelwert in µs, 0 ohne Runden
+ */
+uint64_t runden_mittel_us(void) {
+    if (statistik.anzahl == 0) {
+        return 0;
+    }
+    return statistik.summe_us / statistik.anzahl;
+}
+
+/**
+ * @brief Ganzzahlige Quadratwurzel, bitweise ohne Division
+ * @param wert Radikand
+ * @retval abgerundete Wurzel
+ */
+static uint64_t runden_wurzel(uint64_t wert) {
+    uint64_t ergebnis = 0;
+    uint64_t bit = 1ULL << 62;
+
+    while (bit > wert) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (wert >= ergebnis + bit) {
+            wert -= ergebnis + bit;
+            ergebnis = (ergebnis >> 1) + bit;
+        } else {
+            ergebnis >>= 1;
+        }
+        bit >>= 2;
+    }
+    return ergebnis;
+}
+
+/**
+ * @brief Standardabweichung der Rundenzeiten (Stichprobe, n - 1)
+ *
+ * Aus den Summen der Abweichungen S und ihrer Quadrate Q: Varianz = (Q - S² / n) / (n - 1).
+ * S² / n wird in zwei Teilen gerechnet, damit S² nicht überläuft. Die Rundung der Abweichungen
+ * auf ms verschiebt das Ergebnis um weniger als 1 ms.
+ * @param None
+ * @retval Standardabweichung in µs, 0 bei weniger als zwei Runden
+ */
+uint64_t runden_standardabweichung_us(void) {
+    uint32_t anzahl = statistik.anzahl;
+
+    if (anzahl < 2) {
+        return 0;
+    }
+
+    uint64_t summe = (statistik.abweichung_ms < 0) ? (uint64_t)-statistik.abweichung_ms : (uint64_t)statistik.abweichung_ms;
+    uint64_t summe_quadrat_n = (summe / anzahl) * summe + (summe % anzahl) * summe / anzahl;
+    uint64_t varianz_ms2 = (statistik.quadrate_ms2 - summe_quadrat_n) / (anzahl - 1);
+
+    if (varianz_ms2 <= UINT64_MAX / 1000000) {
+        return runden_wurzel(varianz_ms2 * 1000000);
+    }
+    return runden_wurzel(varianz_ms2) * 1000;
+}
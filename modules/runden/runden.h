@@ -0,0 +1,57 @@
+/**
+ **************************************************
+ * @file        runden.h
+ * @brief       Header-Datei für den Rundenspeicher der Stoppuhr
+ **************************************************
+ */
+
+#ifndef RUNDEN_RUNDEN_H_
+#define RUNDEN_RUNDEN_H_
+
+#include "stm32f4xx.h"
+
+/*Define*/
+#ifndef RUNDEN_RAM_ANZAHL
+#define RUNDEN_RAM_ANZAHL   64 // die letzten Runden im RAM-Ring, Zweierpotenz
+#endif
+
+#ifndef RUNDEN_BKPSRAM_LOG
+#define RUNDEN_BKPSRAM_LOG  1  // 1: alle Runden zusätzlich ins Backup-SRAM (4 KB, 511 Runden) schreiben
+#endif
+
+/**
+ * Eine gespeicherte Runde
+ */
+typedef struct {
+    uint32_t nummer;   // 0 = erste Runde
+    uint64_t zeit_us;  // Rundenzeit in µs
+    int64_t delta_us;  // Rundenzeit minus Zeit der vorherigen Runde, 0 bei der ersten Runde
+} runde_t;
+
+/**
+ * Statistik über alle Runden seit runden_loeschen(), wird bei jeder Runde in O(1) nachgeführt
+ */
+typedef struct {
+    uint32_t anzahl;              // Anzahl der Runden
+    uint64_t beste_us;            // kürzeste Runde
+    uint32_t beste_nummer;
+    uint64_t schlechteste_us;     // längste Runde
+    uint32_t schlechteste_nummer;
+    uint64_t summe_us;            // Summe aller Runden = Zeit bis zum Ende der letzten Runde, ergibt den Mittelwert
+    uint64_t erste_us;            // erste Runde, Bezugswert der Abweichungen
+    int64_t abweichung_ms;        // Summe der Abweichungen von erste_us in ms
+    uint64_t quadrate_ms2;        // Summe ihrer Quadrate in ms², ergibt die Varianz
+    int64_t delta_us;             // letzte Runde minus vorletzte Runde
+} runden_statistik_t;
+
+/*Public Prototyp Funktion*/
+void runden_init(void);
+void runden_loeschen(void);
+void runden_hinzufuegen(uint64_t zeit_us);
+uint32_t runden_anzahl(void);
+uint8_t runden_holen(uint32_t nummer, runde_t* runde);
+const runden_statistik_t* runden_statistik(void);
+uint64_t runden_mittel_us(void);
+uint64_t runden_standardabweichung_us(void);
+
+#endif /* RUNDEN_RUNDEN_H_ */
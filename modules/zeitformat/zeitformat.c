@@ -0,0 +1,295 @@
+/**
+ **************************************************
+ * @file        zeitformat.c
+ * @brief       Formatieren von Zeiten und Zahlen in Puffer des Aufrufers, ohne printf und ohne Division
+ @verbatim
+ ==================================================
+            ### Verwendete Ressourcen ###
+    Tabelle der Ziffernpaare "00".."99" (200 Byte im Flash)
+ ==================================================
+            ###     Verwendung      ###
+    (#) Aufruf von 'zeitformat_mm_ss_cc()' für "MM:SS.CC" aus Hundertstelsekunden.
+    (#) Aufruf von 'zeitformat_hh_mm_ss()' für "HH:MM:SS" aus Sekunden.
+    (#) Aufruf von 'zeitformat_festkomma()' für eine vorzeichenbehaftete Festkommazahl, z. B. "-12.34".
+    (#) Aufruf von 'zeitformat_zahl()' für eine Dezimalzahl ohne führende Nullen.
+    (#) Aufruf von 'zeitformat_us_in_hundertstel()', um Zeiten der Stoppuhr umzurechnen.
+    (#) Aufruf von 'zeitformat_bcd_naechste()', um eine gepackte BCD-Zeit (0xMMMMSSCC) um eine
+        Hundertstelsekunde weiterzuzählen, und 'zeitformat_bcd_mm_ss_cc()', um sie ohne Rechnen
+        als "MM:SS.CC" auszugeben. Zwei BCD-Zeiten mit XOR verglichen zeigen die geänderten Ziffern.
+
+    Alle Funktionen schreiben die Zeichen und ein '\0' nach ziel und geben einen Zeiger
+    auf das '\0' zurück, so können mehrere Aufrufe aneinandergehängt werden. Der Puffer
+    braucht höchstens ZEITFORMAT_PUFFER Zeichen.
+
+    Geteilt wird durch 100, 60, 3600 und 10000 mit Multiplikation und Schieben
+    (Kehrwert als 32-Bit-Konstante), das Ergebnis ist für jeden 32-Bit-Wert exakt. Zwei
+    Ziffern auf einmal kommen aus der Tabelle der Ziffernpaare.
+ ==================================================
+ @endverbatim
+ **************************************************
+ */
+
+#include "zeitformat.h"
+
+/**
+ * Private variablen
+ */
+static const char ziffernpaare[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/**
+ * Ganzzahlige Division durch Konstanten ohne Divisionsbefehl, exakt für alle 32-Bit-Werte
+ */
+static inline uint32_t durch_100(uint32_t x) {
+    return (uint32_t)(((uint64_t)x * 0x51EB851FU) >> 37);
+}
+
+static inline uint32_t durch_60(uint32_t x) {
+    return (uint32_t)(((uint64_t)x * 0x88888889U) >> 37);
+}
+
+static inline uint32_t durch_3600(uint32_t x) {
+    return (uint32_t)(((uint64_t)x * 0x91A2B3C5U) >> 43);
+}
+
+static inline uint32_t durch_10000(uint32_t x) {
+    return (uint32_t)(((uint64_t)x * 0xD1B71759U) >> 45);
+}
+
+static inline uint32_t durch_10(uint32_t x) {
+    return (uint32_t)(((uint64_t)x * 0xCCCCCCCDU) >> 35);
+}
+
+/**
+ * @brief Packt einen Wert 0..99 als zwei BCD-Ziffern
+ * @param wert Wert 0..99
+ * @retval BCD-Byte
+ */
+static inline uint32_t bcd_paar(uint32_t wert) {
+    uint32_t zehner = durch_10(wert);
+    return (zehner << 4) | (wert - zehner * 10);
+}
+
+/**
+ * @brief Schreibt einen Wert 0..99 als zwei Ziffern
+ * @param ziel Zielpuffer
+ * @param wert Wert 0..99
+ * @retval Zeiger hinter die zweite Ziffer
+ */
+static inline char* paar_schreiben(char* ziel, uint32_t wert) {
+    ziel[0] = ziffernpaare[2 * wert];
+    ziel[1] = ziffernpaare[2 * wert + 1];
+    return ziel + 2;
+}
+
+/**
+ * @brief Schreibt einen Wert mit mindestens stellen Ziffern (führende Nullen), ohne '\0'
+ * @param ziel Zielpuffer
+ * @param wert Wert
+ * @param stellen Mindestanzahl der Ziffern, höchstens 10
+ * @retval Zeiger hinter die letzte Ziffer
+ */
+static char* ziffern_schreiben(char* ziel, uint32_t wert, uint8_t stellen) {
+    char puffer[10];
+    char* p = puffer + sizeof(puffer);
+
+    while (wert >= 100) {
+        uint32_t rest = wert;
+        wert = durch_100(wert);
+        p -= 2;
+        paar_schreiben(p, rest - wert * 100);
+    }
+    if (wert >= 10) {
+        p -= 2;
+        paar_schreiben(p, wert);
+    } else {
+        *--p = '0' + wert;
+    }
+    while (p > puffer && (uint8_t)(puffer + sizeof(puffer) - p) < stellen) {
+        *--p = '0';
+    }
+
+    while (p < puffer + sizeof(puffer)) {
+        *ziel++ = *p++;
+    }
+    return ziel;
+}
+
+/**
+ * @brief Formatiert Hundertstelsekunden als "MM:SS.CC", ab 100 Minuten mit mehr Minutenziffern
+ * @param ziel Zielpuffer
+ * @param hundertstel Zeit in Hundertstelsekunden
+ * @retval Zeiger auf das abschließende '\0'
+ */
+char* zeitformat_mm_ss_cc(char* ziel, uint32_t hundertstel) {
+    uint32_t sekunden = durch_100(hundertstel);
+    uint32_t minuten = durch_60(sekunden);
+
+    if (minuten < 100) {
+        ziel = paar_schreiben(ziel, minuten);
+    } else {
+        ziel = ziffern_schreiben(ziel, minuten, 2);
+    }
+    *ziel++ = ':';
+    ziel = paar_schreiben(ziel, sekunden - minuten * 60);
+    *ziel++ = '.';
+    ziel = paar_schreiben(ziel, hundertstel - sekunden * 100);
+    *ziel = '\0';
+    return ziel;
+}
+
+/**
+ * @brief Formatiert Sekunden als "HH:MM:SS", ab 100 Stunden mit mehr Stundenziffern
+ * @param ziel Zielpuffer
+ * @param sekunden Zeit in Sekunden
+ * @retval Zeiger auf das abschließende '\0'
+ */
+char* zeitformat_hh_mm_ss(char* ziel, uint32_t sekunden) {
+    uint32_t stunden = durch_3600(sekunden);
+    uint32_t rest = sekunden - stunden * 3600;
+    uint32_t minuten = durch_60(rest);
+
+    if (stunden < 100) {
+        ziel = paar_schreiben(ziel, stunden);
+    } else {
+        ziel = ziffern_schreiben(ziel, stunden, 2);
+    }
+    *ziel++ = ':';
+    ziel = paar_schreiben(ziel, minuten);
+    *ziel++ = ':';
+    ziel = paar_schreiben(ziel, rest - minuten * 60);
+    *ziel = '\0';
+    return ziel;
+}
+
+/**
+ * @brief Formatiert eine vorzeichenbehaftete Festkommazahl, z. B. wert -1234 mit 2 Nachkommastellen als "-12.34"
+ * @param ziel Zielpuffer
+ * @param wert Wert in Einheiten der letzten Nachkommastelle
+ * @param nachkommastellen Anzahl der Nachkommastellen, 0..9
+ * @retval Zeiger auf das abschließende '\0'
+ */
+char* zeitformat_festkomma(char* ziel, int32_t wert, uint8_t nachkommastellen) {
+    uint32_t betrag = (wert < 0) ? 0U - (uint32_t)wert : (uint32_t)wert;
+    char puffer[10];
+
+    if (wert < 0) {
+        *ziel++ = '-';
+    }
+    if (nachkommastellen > 9) {
+        nachkommastellen = 9;
+    }
+
+    // mindestens eine Ziffer vor dem Komma
+    uint8_t laenge = ziffern_schreiben(puffer, betrag, nachkommastellen + 1) - puffer;
+    uint8_t i = 0;
+
+    while (i < laenge - nachkommastellen) {
+        *ziel++ = puffer[i++];
+    }
+    if (nachkommastellen) {
+        *ziel++ = '.';
+        while (i < laenge) {
+            *ziel++ = puffer[i++];
+        }
+    }
+    *ziel = '\0';
+    return ziel;
+}
+
+/**
+ * @brief Formatiert eine Dezimalzahl ohne führende Nullen
+ * @param ziel Zielpuffer
+ * @param wert Wert
+ * @retval Zeiger auf das abschließende '\0'
+ */
+char* zeitformat_zahl(char* ziel, uint32_t wert) {
+    ziel = ziffern_schreiben(ziel, wert, 1);
+    *ziel = '\0';
+    return ziel;
+}
+
+/**
+ * @brief Rechnet eine Zeit in µs in Hundertstelsekunden um
+ *
+ * Bis 2^32 µs (etwa 71 Minuten) mit Multiplikation, darüber mit einer 64-Bit-Division.
+ * @param us Zeit in µs
+ * @retval Zeit in Hundertstelsekunden
+ */
+uint32_t zeitformat_us_in_hundertstel(uint64_t us) {
+    if (us <= 0xFFFFFFFFU) {
+        return durch_10000((uint32_t)us);
+    }
+    return (uint32_t)(us / 10000);
+}
+
+/**
+ * @brief Rechnet Hundertstelsekunden in eine gepackte BCD-Zeit 0xMMMMSSCC um
+ * @param hundertstel Zeit in Hundertstelsekunden, ab 9999:59.99 bleibt es bei ZEITFORMAT_BCD_MAX
+ * @retval gepackte BCD-Zeit
+ */
+uint32_t zeitformat_bcd_aus_hundertstel(uint32_t hundertstel) {
+    uint32_t sekunden = durch_100(hundertstel);
+    uint32_t minuten = durch_60(sekunden);
+
+    if (minuten > 9999) {
+        return ZEITFORMAT_BCD_MAX;
+    }
+
+    uint32_t minuten_hoch = durch_100(minuten);
+    return (bcd_paar(minuten_hoch) << 24) | (bcd_paar(minuten - minuten_hoch * 100) << 16)
+            | (bcd_paar(sekunden - minuten * 60) << 8) | bcd_paar(hundertstel - sekunden * 100);
+}
+
+/**
+ * @brief Zählt eine gepackte BCD-Zeit um eine Hundertstelsekunde weiter
+ *
+ * Der Übertrag läuft von Ziffer zu Ziffer; die Zehner der Sekunden laufen bei 6 über, alle
+ * anderen bei 10. Meist ändert sich nur die letzte Ziffer und die Schleife endet sofort.
+ * @param bcd gepackte BCD-Zeit
+ * @retval gepackte BCD-Zeit eine Hundertstelsekunde später, höchstens ZEITFORMAT_BCD_MAX
+ */
+uint32_t zeitformat_bcd_naechste(uint32_t bcd) {
+    if (bcd == ZEITFORMAT_BCD_MAX) {
+        return bcd;
+    }
+
+    for (uint8_t stelle = 0; stelle < 32; stelle += 4) {
+        uint32_t ziffer = ((bcd >> stelle) & 0xF) + 1;
+        uint32_t ueberlauf = (stelle == 12) ? 6 : 10;
+
+        if (ziffer < ueberlauf) {
+            return (bcd & ~(0xFU << stelle)) | (ziffer << stelle);
+        }
+        bcd &= ~(0xFU << stelle);
+    }
+    return bcd;
+}
+
+/**
+ * @brief Gibt eine gepackte BCD-Zeit als "MM:SS.CC" aus, Minuten mit mindestens zwei Ziffern
+ * @param ziel Zielpuffer
+ * @param bcd gepackte BCD-Zeit
+ * @retval Zeiger auf das abschließende '\0'
+ */
+char* zeitformat_bcd_mm_ss_cc(char* ziel, uint32_t bcd) {
+    int8_t stelle = 28;
+
+    // führende Nullen der Minuten bis auf zwei Ziffern auslassen
+    while (stelle > 20 && ((bcd >> stelle) & 0xF) == 0) {
+        stelle -= 4;
+    }
+    for (; stelle >= 16; stelle -= 4) {
+        *ziel++ = '0' + ((bcd >> stelle) & 0xF);
+    }
+    *ziel++ = ':';
+    *ziel++ = '0' + ((bcd >> 12) & 0xF);
+    *ziel++ = '0' + ((bcd >> 8) & 0xF);
+    *ziel++ = '.';
+    *ziel++ = '0' + ((bcd >> 4) & 0xF);
+    *ziel++ = '0' + (bcd & 0xF);
+    *ziel = '\0';
+    return ziel;
+}
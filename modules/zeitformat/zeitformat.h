@@ -0,0 +1,33 @@
+/**
+ **************************************************
+ * @file        zeitformat.h
+ * @brief       Header-Datei für das Formatieren von Zeiten und Zahlen ohne printf
+ **************************************************
+ */
+
+#ifndef ZEITFORMAT_ZEITFORMAT_H_
+#define ZEITFORMAT_ZEITFORMAT_H_
+
+#include "stm32f4xx.h"
+
+/*Define*/
+#define ZEITFORMAT_PUFFER   16 // reicht für jede Ausgabe des Moduls einschließlich '\0'
+
+/**
+ * Gepackte BCD-Zeit in einem 32-Bit-Wort, eine Ziffer pro Halbbyte: 0xMMMMSSCC
+ * (Minuten 0..9999, Sekunden 0..59, Hundertstel 0..99)
+ */
+#define ZEITFORMAT_BCD_MAX  0x99995999U // 9999:59.99, weiter zählt zeitformat_bcd_naechste() nicht
+
+/*Public Prototyp Funktion*/
+char* zeitformat_mm_ss_cc(char* ziel, uint32_t hundertstel);
+char* zeitformat_hh_mm_ss(char* ziel, uint32_t sekunden);
+char* zeitformat_festkomma(char* ziel, int32_t wert, uint8_t nachkommastellen);
+char* zeitformat_zahl(char* ziel, uint32_t wert);
+uint32_t zeitformat_us_in_hundertstel(uint64_t us);
+
+uint32_t zeitformat_bcd_aus_hundertstel(uint32_t hundertstel);
+uint32_t zeitformat_bcd_naechste(uint32_t bcd);
+char* zeitformat_bcd_mm_ss_cc(char* ziel, uint32_t bcd);
+
+#endif /* ZEITFORMAT_ZEITFORMAT_H_ */
@@ -0,0 +1,13 @@
+#!/bin/sh
+# Regenerates the glyph atlases in modules/lcd/fonts from modules/lcd/5x5_font.h.
+set -e
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+FONTS="$HERE/../../modules/lcd/fonts"
+
+gcc -std=gnu11 -O2 -Wall -o "$HERE/lcd_font" "$HERE/lcd_font.c"
+mkdir -p "$FONTS"
+for SIZE in 2 3; do
+	"$HERE/lcd_font" $SIZE ILI9341_Font_Fixed_$SIZE > "$FONTS/ILI9341_Font_Fixed_$SIZE.c"
+	"$HERE/lcd_font" -p $SIZE ILI9341_Font_Prop_$SIZE > "$FONTS/ILI9341_Font_Prop_$SIZE.c"
+done
@@ -0,0 +1,222 @@
+/**
+ * Generates a C file with one ILI9341_Font (see modules/lcd/ILI9341_Font.h)
+ * from the 5x5 font of modules/lcd/5x5_font.h, scaled to a fixed text size.
+ *
+ *   lcd_font [-p] size name > name.c
+ *
+ * Without -p every glyph keeps its 6 columns, the output is pixel for pixel
+ * what ILI9341_Draw_Char draws at that size. With -p the empty columns left
+ * and right of a glyph are cut off and one empty column is put between the
+ * glyphs; digits keep one common width so numbers do not move. Pairs whose
+ * outlines leave two or more empty columns between them are moved one
+ * column closer (kerning).
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../../modules/lcd/5x5_font.h"
+
+#define FIRST		' '
+#define COUNT		96
+#define NONE		-1
+
+/* width of the space in proportional fonts, in font columns */
+#define SPACE_WIDTH	3
+
+/* kerning is only worked out between letters and these characters */
+static const char kerned_punctuation[] = ".,:;'\"-";
+
+typedef struct
+{
+	int first, width, advance;	/* font columns: first column taken from the 5x5 font, bitmap width, advance */
+	int left[CHAR_HEIGHT];		/* first and last lit column of every row in the bitmap, NONE if empty */
+	int right[CHAR_HEIGHT];
+} glyph_t;
+
+static glyph_t glyphs[COUNT];
+
+static int lit(int index, int column, int row)
+{
+	return column >= 0 && column < CHAR_WIDTH && (font[index][column] >> row) & 1;
+}
+
+static int is_digit(int index)
+{
+	return index + FIRST >= '0' && index + FIRST <= '9';
+}
+
+static int is_kerned(int index)
+{
+	char c = (char)(index + FIRST);
+	return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || strchr(kerned_punctuation, c);
+}
+
+static void measure(int proportional)
+{
+	int digit_width = 0;
+
+	for(int i = 0; i < COUNT; i++)
+	{
+		glyph_t *g = &glyphs[i];
+		int first = CHAR_WIDTH, last = NONE;
+
+		for(int c = 0; c < CHAR_WIDTH; c++)
+		{
+			if(font[i][c]) { if(c < first) first = c; last = c; }
+		}
+
+		if(!proportional)
+		{
+			g->first = 0;
+			g->width = CHAR_WIDTH;
+			g->advance = CHAR_WIDTH;
+		}
+		else if(last == NONE)
+		{
+			g->first = 0;
+			g->width = 0;
+			g->advance = SPACE_WIDTH;
+		}
+		else
+		{
+			g->first = first;
+			g->width = last - first + 1;
+			g->advance = g->width + 1;
+		}
+		if(proportional && is_digit(i) && g->width > digit_width) digit_width = g->width;
+	}
+
+	/* tabular digits: narrower ones are centred in the common width */
+	for(int i = 0; proportional && i < COUNT; i++)
+	{
+		glyph_t *g = &glyphs[i];
+		if(!is_digit(i)) continue;
+
+		g->first -= (digit_width - g->width) / 2;
+		g->width = digit_width;
+		g->advance = digit_width + 1;
+	}
+
+	for(int i = 0; i < COUNT; i++)
+	{
+		glyph_t *g = &glyphs[i];
+		for(int r = 0; r < CHAR_HEIGHT; r++)
+		{
+			g->left[r] = g->right[r] = NONE;
+			for(int c = 0; c < g->width; c++)
+			{
+				if(!lit(i, g->first + c, r)) continue;
+				if(g->left[r] == NONE) g->left[r] = c;
+				g->right[r] = c;
+			}
+		}
+	}
+}
+
+/* columns the second glyph can move closer without coming nearer than one empty column, also diagonally */
+static int kerning(int a, int b)
+{
+	const glyph_t *ga = &glyphs[a], *gb = &glyphs[b];
+	int gap = ga->advance + CHAR_WIDTH;
+
+	if(ga->width == 0 || gb->width == 0 || !is_kerned(a) || !is_kerned(b)) return 0;
+
+	for(int ra = 0; ra < CHAR_HEIGHT; ra++)
+	{
+		if(ga->right[ra] == NONE) continue;
+		for(int rb = ra - 1; rb <= ra + 1; rb++)
+		{
+			if(rb < 0 || rb >= CHAR_HEIGHT || gb->left[rb] == NONE) continue;
+			int g = ga->advance + gb->left[rb] - ga->right[ra] - 1;
+			if(g < gap) gap = g;
+		}
+	}
+	return gap >= 2 ? 1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+	int proportional = 0;
+	int arg = 1;
+
+	if(argc >= 2 && strcmp(argv[1], "-p") == 0)
+	{
+		proportional = 1;
+		arg = 2;
+	}
+	if(argc - arg != 2 || atoi(argv[arg]) < 1 || atoi(argv[arg]) > 8)
+	{
+		fprintf(stderr, "usage: %s [-p] size(1..8) name > name.c\n", argv[0]);
+		return 1;
+	}
+	int size = atoi(argv[arg]);
+	const char *name = argv[arg + 1];
+
+	measure(proportional);
+
+	/* bitmaps: every font row once, scaled horizontally, leftmost pixel in bit 7 */
+	uint8_t *bitmaps = calloc(COUNT * CHAR_HEIGHT * ((CHAR_WIDTH * size + 7) / 8), 1);
+	int offsets[COUNT];
+	int bytes = 0;
+
+	for(int i = 0; i < COUNT; i++)
+	{
+		const glyph_t *g = &glyphs[i];
+		int row_bytes = (g->width * size + 7) / 8;
+
+		offsets[i] = bytes;
+		for(int r = 0; r < CHAR_HEIGHT && row_bytes; r++, bytes += row_bytes)
+		{
+			for(int x = 0; x < g->width * size; x++)
+			{
+				if(lit(i, g->first + x / size, r)) bitmaps[bytes + x / 8] |= 0x80 >> (x % 8);
+			}
+		}
+	}
+
+	int kerns = 0;
+	for(int a = 0; a < COUNT; a++)
+		for(int b = 0; b < COUNT; b++)
+			kerns += proportional && kerning(a, b);
+
+	printf("/* Generated by tools/lcd_font from modules/lcd/5x5_font.h: size %d, %s, %d bytes of bitmaps, %d kerning pairs */\n",
+		   size, proportional ? "proportional" : "fixed width", bytes, kerns);
+	printf("#include <lcd/ILI9341_Font.h>\n\n");
+
+	printf("static const uint8_t %s_bitmaps[] =\n{", name);
+	for(int i = 0; i < bytes; i++) printf("%s0x%02X,", i % 16 ? " " : "\n\t", bitmaps[i]);
+	printf("\n};\n\n");
+
+	printf("static const ILI9341_Font_Glyph %s_glyphs[] =\n{\n", name);
+	for(int i = 0; i < COUNT; i++)
+	{
+		printf("\t{ %4d, %2d, %2d },", offsets[i], glyphs[i].width * size, glyphs[i].advance * size);
+		if(i + FIRST < 127) printf("\t/* '%c' */\n", i + FIRST);
+		else printf("\t/* DEL */\n");
+	}
+	printf("};\n\n");
+
+	if(kerns)
+	{
+		int n = 0;
+		printf("static const ILI9341_Font_Kern %s_kerns[] =\n{", name);
+		for(int a = 0; a < COUNT; a++)
+		{
+			for(int b = 0; b < COUNT; b++)
+			{
+				if(!kerning(a, b)) continue;
+				printf("%s{ '%s%c', '%s%c', %d },", n++ % 6 ? " " : "\n\t", a + FIRST == '\'' ? "\\" : "", a + FIRST,
+					   b + FIRST == '\'' ? "\\" : "", b + FIRST, -size);
+			}
+		}
+		printf("\n};\n\n");
+	}
+
+	printf("const ILI9341_Font %s =\n{\n", name);
+	printf("\t%d, %d, ' ', %d,\n", CHAR_HEIGHT * size, size, COUNT);
+	printf("\t%s_glyphs, %s_bitmaps,\n", name, name);
+	if(kerns) printf("\t%d, %s_kerns\n};\n", kerns, name);
+	else printf("\t0, 0\n};\n");
+	return 0;
+}
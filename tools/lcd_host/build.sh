@@ -0,0 +1,23 @@
+#!/bin/sh
+# Builds a modules/lcd program for the host with gcc.
+#   ./build.sh [program.c] [output]
+# The tile compositor is compiled in, the program decides whether it is used.
+set -e
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+MODULES="$HERE/../../modules"
+SRC=${1:-$HERE/compositor_demo.c}
+OUT=${2:-$HERE/compositor_demo}
+
+gcc -std=gnu11 -O2 -Wall -Wno-unused-function $CFLAGS \
+	-DILI9341_SHADOW_ENABLE=1 \
+	-I"$HERE/include" -I"$HERE" -I"$MODULES" \
+	-o "$OUT" "$SRC" "$HERE/hal_mock.c" \
+	"$MODULES/lcd/lcd.c" "$MODULES/lcd/ILI9341_GFX.c" \
+	"$MODULES/lcd/ILI9341_STM32_Driver.c" "$MODULES/lcd/ILI9341_Shadow.c" \
+	"$MODULES/lcd/ILI9341_Image.c" "$MODULES/lcd/ILI9341_Queue.c" \
+	"$MODULES/lcd/ILI9341_Font.c" "$MODULES/lcd/ILI9341_Shapes.c" \
+	"$MODULES/lcd/ILI9341_Region.c" "$MODULES/lcd/ILI9341_SPI.c" \
+	"$MODULES/lcd/ILI9341_SPI_DMA.c" "$HERE/host_transport.c" \
+	"$MODULES"/lcd/fonts/*.c \
+	"$MODULES/my_lcd/my_lcd.c" "$MODULES/zeitformat/zeitformat.c"
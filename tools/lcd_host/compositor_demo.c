@@ -0,0 +1,97 @@
+/**
+ * Draws the weather station screen (P2_Weatherstation) for a number of frames,
+ * once straight to the panel and once through the tile compositor, and
+ * reports the bytes sent per frame and how often the tile pool ran full.
+ * The last frame of each run is written to a PPM file.
+ */
+#include <stdio.h>
+#include <lcd/lcd.h>
+#include "my_lcd/my_lcd.h"
+#include "hal_mock.h"
+
+#define FRAMES	50
+
+static my_lcd_bargraph_t temp_balken;
+static my_lcd_bargraph_t press_balken;
+static my_lcd_bargraph_t hum_balken;
+static my_lcd_stripchart_t press_verlauf;
+
+/* the same calls as one pass of the main loop of P2_Weatherstation */
+static void draw_frame(int frame)
+{
+	char text[32];
+	float temp = 21.0f + (frame % 20) * 0.05f;
+	float press = 1013.0f + (frame % 7) * 0.25f;
+	float hum = 45.0f + (frame / 10);
+
+	/* the node switch clears everything before it is drawn again */
+	if(frame % 10 == 0)
+	{
+		lcd_draw_rect(140, 62, 240, 320, WHITE, 1);
+		lcd_draw_rect(140, 112, 240, 320, WHITE, 1);
+		lcd_draw_rect(140, 162, 240, 320, WHITE, 1);
+		my_lcd_draw_baargraph(20, 60, 110, 20, 0, WHITE, WHITE);
+		my_lcd_draw_baargraph(20, 110, 110, 20, 0, WHITE, WHITE);
+		my_lcd_draw_baargraph(20, 160, 110, 20, 0, WHITE, WHITE);
+		my_lcd_bargraph_invalidate(&temp_balken);
+		my_lcd_bargraph_invalidate(&press_balken);
+		my_lcd_bargraph_invalidate(&hum_balken);
+		my_lcd_stripchart_clear(&press_verlauf);
+	}
+
+	sprintf(text, "%.2f C", temp);
+	lcd_draw_text_at_coord(text, 140, 62, RED, 2, WHITE);
+	my_lcd_bargraph_update(&temp_balken, (uint16_t)(temp * 1000.0f / 50.0f));
+
+	my_lcd_bargraph_update(&press_balken, (uint16_t)(press * 1000.0f / 1100.0f));
+	sprintf(text, "%.2f hPa", press);
+	lcd_draw_text_at_coord(text, 140, 112, BLUE, 2, WHITE);
+	my_lcd_stripchart_add(&press_verlauf, (int32_t)(press * 100));
+
+	my_lcd_bargraph_update(&hum_balken, (uint16_t)(hum * 10.0f));
+	sprintf(text, "%.2f %%", hum);
+	lcd_draw_text_at_coord(text, 140, 162, GREEN, 2, WHITE);
+}
+
+static void run(const char* name, int composited)
+{
+	uint32_t total = 0;
+
+	my_lcd_bargraph_init(&temp_balken, 20, 60, 110, 20, RED, YELLOW);
+	my_lcd_bargraph_init(&press_balken, 20, 110, 110, 20, BLUE, YELLOW);
+	my_lcd_bargraph_init(&hum_balken, 20, 160, 110, 20, GREEN, YELLOW);
+	my_lcd_stripchart_init(&press_verlauf, 20, 200, 200, 100, BLUE, BLACK, 0, 1, 1);
+
+	lcd_fill_screen(WHITE);
+	if(composited) lcd_compositor_begin();
+	draw_frame(0);
+	lcd_flush();
+
+	uint16_t pool_flushes = ILI9341_Shadow_Pool_Flushes;
+	for(int frame = 1; frame <= FRAMES; frame++)
+	{
+		host_reset_bytes();
+		draw_frame(frame);
+		lcd_flush();
+		lcd_wait_idle();
+		total += host_bytes_sent;
+	}
+	lcd_compositor_end();
+
+	printf("%-12s %8u bytes/frame", name, (unsigned)(total / FRAMES));
+	if(composited) printf(" %4u pool flushes in %u frames (%u tiles)", (unsigned)(ILI9341_Shadow_Pool_Flushes - pool_flushes), FRAMES, ILI9341_SHADOW_TILES);
+	printf("\n");
+
+	char path[64];
+	snprintf(path, sizeof(path), "%s.ppm", name);
+	host_write_ppm(path);
+}
+
+int main(void)
+{
+	lcd_init();
+
+	run("direct", 0);
+	run("composited", ILI9341_SHADOW_ENABLE);
+	return 0;
+}
@@ -0,0 +1,85 @@
+/**
+ * Cost and correctness of the dial widget of modules/my_lcd: the bytes the
+ * face takes once, the bytes per needle move, and whether the screen after a
+ * long sweep of the needle is the same as a freshly drawn dial showing the
+ * last value. Done for a radius 100 dial and for the tachometer of
+ * P1_Fan_Control. Exits with 1 if a screen differs.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lcd/lcd.h>
+#include "my_lcd/my_lcd.h"
+#include "hal_mock.h"
+
+#define MOVES	1000
+
+static uint8_t picture[2][HOST_PANEL_WIDTH * HOST_PANEL_HEIGHT * 3 + 64];
+
+/* the screen as a PPM image in memory */
+static size_t snapshot(uint8_t* buffer)
+{
+	FILE* f;
+	size_t size;
+
+	host_write_ppm("dial_check.ppm");
+	f = fopen("dial_check.ppm", "rb");
+	if(!f) return 0;
+	size = fread(buffer, 1, sizeof(picture[0]), f);
+	fclose(f);
+	remove("dial_check.ppm");
+	return size;
+}
+
+static int check(const char* name, uint16_t cx, uint16_t cy, uint16_t radius, int32_t max, uint8_t ticks)
+{
+	my_lcd_dial_t dial;
+	uint32_t moved = 0, moves = 0;
+	int32_t value = 0;
+
+	srand(1);
+	lcd_fill_screen(WHITE);
+	lcd_wait_idle();
+	host_reset_bytes();
+	my_lcd_dial_init(&dial, cx, cy, radius, -135, 270, 0, max, ticks, BLACK, BLUE, WHITE);
+	lcd_wait_idle();
+	uint32_t face = host_bytes_sent;
+
+	/* a random walk over the whole scale with some jumps, like a fan speeding up and slowing down */
+	for(int i = 0; i < MOVES; i++)
+	{
+		if(i % 100 == 0) value = rand() % (max + 1);
+		else value += rand() % (max / 20 + 1) - max / 40;
+
+		int16_t angle = dial.angle;
+		host_reset_bytes();
+		my_lcd_dial_update(&dial, value);
+		lcd_wait_idle();
+		if(dial.angle != angle)
+		{
+			moved += host_bytes_sent;
+			moves++;
+		}
+	}
+	size_t size = snapshot(picture[0]);
+
+	lcd_fill_screen(WHITE);
+	my_lcd_dial_init(&dial, cx, cy, radius, -135, 270, 0, max, ticks, BLACK, BLUE, WHITE);
+	my_lcd_dial_update(&dial, value);
+	lcd_wait_idle();
+	int same = snapshot(picture[1]) == size && memcmp(picture[0], picture[1], size) == 0;
+
+	printf("%-16s face %6u bytes, %4u needle moves of %u updates, %4u bytes per move, screen after the sweep %s\n",
+		   name, (unsigned)face, (unsigned)moves, MOVES, moves ? (unsigned)(moved / moves) : 0, same ? "same" : "DIFFERENT");
+	return same;
+}
+
+int main(void)
+{
+	int same = 1;
+
+	lcd_init();
+	same &= check("radius 100", 120, 160, 100, 1000, 10);
+	same &= check("P1 tachometer", 120, 138, 31, 4000, 8);
+	return same ? 0 : 1;
+}
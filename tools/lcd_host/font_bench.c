@@ -0,0 +1,111 @@
+/**
+ * Characters per second of the text renderer, once on the wire and once for
+ * the CPU alone.
+ *
+ * The wire figure is what the SPI manages at 8 MBit/s including the address
+ * windows, the CPU figure is the time the host needs to render the pixels into
+ * the transmit buffer without sending them. On the board both overlap, the
+ * slower one limits.
+ *
+ * Built normally the sizes 2 and 3 are drawn from the glyph atlases, built with
+ * CFLAGS=-DILI9341_FONT_ATLAS=0 the same calls take the glyph expansion
+ * with its cache, as before the atlases.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <lcd/lcd.h>
+#include "hal_mock.h"
+
+#define WIRE_ROUNDS		20
+#define CPU_ROUNDS		20000
+
+static const char* texts[] = { "21.35 C", "1013.25 hPa", "45.00 %", "12:34.56", "Temperatur", "Luftfeuchtigkeit" };
+#define TEXTS	(sizeof(texts) / sizeof(texts[0]))
+
+static uint16_t buffer[BURST_MAX_PIXELS];
+
+static double seconds(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static unsigned characters(void)
+{
+	unsigned n = 0;
+	for(unsigned i = 0; i < TEXTS; i++) n += strlen(texts[i]);
+	return n;
+}
+
+/* font 0 draws with ILI9341_Draw_Text at size */
+static void draw(const ILI9341_Font* font, uint16_t size, const char* text)
+{
+	if(font) ILI9341_Draw_Text_Font(font, text, 0, 100, BLACK, WHITE);
+	else ILI9341_Draw_Text(text, 0, 100, BLACK, size, WHITE);
+}
+
+/* the pixels of one text into the buffer, the way the drawing call renders them */
+static void render(const ILI9341_Font* font, uint16_t size, const char* text)
+{
+	uint16_t length = strlen(text);
+
+	if(!font) font = ILI9341_Get_Font(size);
+	if(font)
+	{
+		ILI9341_Text_Run run;
+		ILI9341_Text_Run_Init(&run, font, text, length, ILI9341_Get_Text_Width(font, text, length), font->Height, BLACK, WHITE);
+		while(ILI9341_Render_Text(&run, buffer));
+		return;
+	}
+
+	uint16_t width = ILI9341_Get_Char_Width(' ', size);
+	uint16_t height = ILI9341_Get_Char_Height(size);
+	for(; *text; text++)
+	{
+		for(uint16_t row = 0; row < height; )
+		{
+			row += ILI9341_Render_Char_Rows(*text, size, BLACK, WHITE, width, height, row, buffer);
+		}
+	}
+}
+
+static void bench(const char* name, const ILI9341_Font* font, uint16_t size)
+{
+	unsigned n = characters();
+
+	host_reset_bytes();
+	uint64_t start = host_time_us;
+	for(int round = 0; round < WIRE_ROUNDS; round++)
+	{
+		for(unsigned i = 0; i < TEXTS; i++) draw(font, size, texts[i]);
+	}
+	lcd_wait_idle();
+	double wire = (double)(host_time_us - start) * 1e-6;
+	uint32_t bytes = host_bytes_sent;
+
+	double cpu = seconds();
+	for(int round = 0; round < CPU_ROUNDS; round++)
+	{
+		for(unsigned i = 0; i < TEXTS; i++) render(font, size, texts[i]);
+	}
+	cpu = seconds() - cpu;
+
+	printf("%-24s %7.1f bytes/char %9.0f chars/s wire %11.0f chars/s cpu\n", name,
+		   (double)bytes / (n * WIRE_ROUNDS), n * WIRE_ROUNDS / wire, n * CPU_ROUNDS / cpu);
+}
+
+int main(void)
+{
+	lcd_init();
+
+	printf("ILI9341_FONT_ATLAS=%d\n", ILI9341_FONT_ATLAS);
+	bench("Draw_Text size 2", 0, 2);
+	bench("Draw_Text size 3", 0, 3);
+#if ILI9341_FONT_ATLAS
+	bench("ILI9341_Font_Prop_2", &ILI9341_Font_Prop_2, 0);
+	bench("ILI9341_Font_Prop_3", &ILI9341_Font_Prop_3, 0);
+#endif
+	return 0;
+}
@@ -0,0 +1,173 @@
+/**
+ * Calls per second of the zeitformat functions against the snprintf calls
+ * they replace in the stopwatch, on the host CPU.
+ *
+ * Every function is first compared against snprintf on a sweep of values;
+ * the program stops with the first difference. The figures are for the
+ * host, on the board both sides are slower, snprintf more so because of the
+ * divisions and the format parsing.
+ *
+ * The BCD line formats the packed BCD time the stopwatch display keeps, the
+ * values are converted before the timing. zeitformat_bcd_naechste() is
+ * checked against the conversion for every hundredth up to 9999:59.99.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <zeitformat/zeitformat.h>
+
+#define VALUES			1024
+#define ROUNDS			2000
+
+static uint32_t values[VALUES];
+static volatile uint32_t sink;
+
+static double seconds(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+/* the replaced formats */
+static void printf_mm_ss_cc(char* text, uint32_t value)
+{
+	snprintf(text, ZEITFORMAT_PUFFER, "%02lu:%02lu.%02lu", (unsigned long)(value / 6000), (unsigned long)((value % 6000) / 100), (unsigned long)(value % 100));
+}
+
+static void printf_hh_mm_ss(char* text, uint32_t value)
+{
+	snprintf(text, ZEITFORMAT_PUFFER, "%02lu:%02lu:%02lu", (unsigned long)(value / 3600), (unsigned long)((value % 3600) / 60), (unsigned long)(value % 60));
+}
+
+static void printf_fixed(char* text, uint32_t value)
+{
+	int32_t v = (int32_t)value;
+	uint32_t a = (v < 0) ? 0U - (uint32_t)v : (uint32_t)v;
+	snprintf(text, ZEITFORMAT_PUFFER, "%s%lu.%02lu", (v < 0) ? "-" : "", (unsigned long)(a / 100), (unsigned long)(a % 100));
+}
+
+static void printf_number(char* text, uint32_t value)
+{
+	snprintf(text, ZEITFORMAT_PUFFER, "%lu", (unsigned long)value);
+}
+
+static void format_mm_ss_cc(char* text, uint32_t value) { zeitformat_mm_ss_cc(text, value); }
+static void format_hh_mm_ss(char* text, uint32_t value) { zeitformat_hh_mm_ss(text, value); }
+static void format_fixed(char* text, uint32_t value) { zeitformat_festkomma(text, (int32_t)value, 2); }
+static void format_number(char* text, uint32_t value) { zeitformat_zahl(text, value); }
+static void format_bcd(char* text, uint32_t value) { zeitformat_bcd_mm_ss_cc(text, value); }
+
+/* the BCD sweep and timing get the packed digits of the same times */
+static void printf_bcd(char* text, uint32_t value)
+{
+	uint32_t minutes = ((value >> 28) & 0xF) * 1000 + ((value >> 24) & 0xF) * 100 + ((value >> 20) & 0xF) * 10 + ((value >> 16) & 0xF);
+	uint32_t seconds = ((value >> 12) & 0xF) * 10 + ((value >> 8) & 0xF);
+	uint32_t hundredths = ((value >> 4) & 0xF) * 10 + (value & 0xF);
+	printf_mm_ss_cc(text, minutes * 6000 + seconds * 100 + hundredths);
+}
+
+typedef void (*formatter)(char* text, uint32_t value);
+
+static int check(const char* name, formatter reference, formatter tested, uint32_t value)
+{
+	char a[ZEITFORMAT_PUFFER];
+	char b[ZEITFORMAT_PUFFER];
+
+	reference(a, value);
+	tested(b, value);
+	if(strcmp(a, b) == 0) return 1;
+	printf("%s differs at %lu: \"%s\" \"%s\"\n", name, (unsigned long)value, a, b);
+	return 0;
+}
+
+static int count_bcd(void)
+{
+	uint32_t bcd = 0;
+	for(uint32_t value = 0; value < 9999 * 6000 + 5999; value++)
+	{
+		bcd = zeitformat_bcd_naechste(bcd);
+		if(bcd != zeitformat_bcd_aus_hundertstel(value + 1))
+		{
+			printf("bcd differs after %lu: %08lx %08lx\n", (unsigned long)value, (unsigned long)bcd, (unsigned long)zeitformat_bcd_aus_hundertstel(value + 1));
+			return 0;
+		}
+	}
+	return zeitformat_bcd_naechste(bcd) == ZEITFORMAT_BCD_MAX;
+}
+
+static int sweep_bcd(void)
+{
+	for(uint32_t value = 0; value < 10000000; value += 7)
+	{
+		if(!check("bcd", printf_bcd, format_bcd, zeitformat_bcd_aus_hundertstel(value))) return 0;
+	}
+	return count_bcd();
+}
+
+static int sweep(const char* name, formatter reference, formatter tested)
+{
+	for(uint32_t value = 0; value < 1000000; value++)
+	{
+		if(!check(name, reference, tested, value)) return 0;
+	}
+	for(uint32_t value = 0xFFFFFFFFU; value > 0xFFFFFFFFU - 1000000; value--)
+	{
+		if(!check(name, reference, tested, value)) return 0;
+	}
+	for(int i = 0; i < VALUES; i++)
+	{
+		if(!check(name, reference, tested, values[i])) return 0;
+	}
+	return 1;
+}
+
+static double rate(formatter f)
+{
+	char text[ZEITFORMAT_PUFFER];
+	uint32_t sum = 0;
+
+	double t = seconds();
+	for(int round = 0; round < ROUNDS; round++)
+	{
+		for(int i = 0; i < VALUES; i++)
+		{
+			f(text, values[i]);
+			sum += text[0] + text[5];
+		}
+	}
+	t = seconds() - t;
+	sink = sum;
+	return (double)ROUNDS * VALUES / t;
+}
+
+static int bench(const char* name, formatter reference, formatter tested)
+{
+	if(!sweep(name, reference, tested)) return 0;
+
+	double slow = rate(reference);
+	double fast = rate(tested);
+	printf("%-12s %12.0f calls/s snprintf %12.0f calls/s zeitformat %6.1fx\n", name, slow, fast, fast / slow);
+	return 1;
+}
+
+int main(void)
+{
+	/* stopwatch values below an hour, as in the common path, the sweep covers the rest */
+	srand(1);
+	for(int i = 0; i < VALUES; i++) values[i] = (uint32_t)rand() % 360000;
+
+	int ok = bench("mm:ss.cc", printf_mm_ss_cc, format_mm_ss_cc)
+		&& bench("hh:mm:ss", printf_hh_mm_ss, format_hh_mm_ss)
+		&& bench("fixed .2", printf_fixed, format_fixed)
+		&& bench("number", printf_number, format_number)
+		&& sweep_bcd();
+	if(!ok) return 1;
+
+	for(int i = 0; i < VALUES; i++) values[i] = zeitformat_bcd_aus_hundertstel(values[i]);
+	double slow = rate(printf_bcd);
+	double fast = rate(format_bcd);
+	printf("%-12s %12.0f calls/s snprintf %12.0f calls/s zeitformat %6.1fx\n", "bcd mm:ss.cc", slow, fast, fast / slow);
+	return 0;
+}
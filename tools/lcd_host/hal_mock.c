@@ -0,0 +1,399 @@
+/**
+ * Host implementation of the HAL functions used by modules/lcd.
+ *
+ * Every byte the driver sends goes through wire_byte(), which follows the
+ * chip select and data/command lines like the ILI9341 does: 0x2A/0x2B set the
+ * address window, 0x2C starts pixel data, 0x36 (MADCTL) sets the rotation,
+ * 0x33/0x37 define and move the vertical scroll area.
+ * DMA transfers complete immediately, the completion callback runs as soon
+ * as the DMA interrupt is enabled. With host_dma_wire_time(1) they take their
+ * wire time instead: the CPU clock goes on, and the interrupt comes once the
+ * clock has passed the end of the transfer, at the latest when a wait loop of
+ * the driver calls host_wait(). In 16 bit frame mode (CR1 DFF) every frame
+ * is a native uint16_t that goes out high byte first, like on the STM32.
+ * The wire time of a frame follows the prescaler in CR1 (BR) and HOST_PCLK2_HZ.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "stm32f4xx_hal.h"
+#include "hal_mock.h"
+
+GPIO_TypeDef host_gpioc, host_gpiod, host_gpiof;
+SPI_TypeDef host_spi5;
+DMA_Stream_TypeDef host_dma2_stream6;
+
+uint32_t host_bytes_sent;
+uint32_t host_frames_sent;
+uint64_t host_time_us;
+host_stats_t host_stats;
+
+static uint64_t time_ns;
+
+static uint16_t panel[HOST_PANEL_HEIGHT][HOST_PANEL_WIDTH];
+static int cs_low, dc_high;
+static uint8_t command;
+static uint8_t args[6];
+static int nargs;
+static int have_high;
+static uint8_t high;
+static uint16_t col_start, col_end, page_start, page_end, col, page;
+static uint8_t madctl;
+static uint16_t scroll_top, scroll_height = HOST_PANEL_HEIGHT, scroll_start;
+
+static int irq_enabled = 1, in_irq, dma_done, dma_hold, dma_timed;
+static uint64_t dma_end_ns;
+static SPI_HandleTypeDef *dma_spi;
+
+static void put_pixel(uint16_t colour)
+{
+	int x, y;
+
+	/* logical column/page to panel memory, MV swaps, MX/MY mirror */
+	if(madctl & 0x20) { x = page; y = col; } else { x = col; y = page; }
+	if(madctl & 0x40) x = HOST_PANEL_WIDTH - 1 - x;
+	if(madctl & 0x80) y = HOST_PANEL_HEIGHT - 1 - y;
+	if(x >= 0 && x < HOST_PANEL_WIDTH && y >= 0 && y < HOST_PANEL_HEIGHT) panel[y][x] = colour;
+	host_stats.pixels++;
+
+	if(++col > col_end) { col = col_start; if(++page > page_end) page = page_start; }
+}
+
+static void wire_byte(uint8_t b)
+{
+	host_bytes_sent++;
+	host_stats.bytes++;
+	if(!cs_low) return;
+
+	if(!dc_high)
+	{
+		command = b;
+		nargs = 0;
+		have_high = 0;
+		host_stats.commands++;
+		if(command == 0x2C) { col = col_start; page = page_start; host_stats.memory_writes++; }
+		return;
+	}
+
+	if(command == 0x2C)
+	{
+		if(!have_high) { high = b; have_high = 1; }
+		else { have_high = 0; put_pixel((uint16_t)(high << 8 | b)); }
+		return;
+	}
+
+	if(nargs < 6) args[nargs++] = b;
+	if(command == 0x2A && nargs == 4) { col_start = args[0] << 8 | args[1]; col_end = args[2] << 8 | args[3]; }
+	if(command == 0x2B && nargs == 4) { page_start = args[0] << 8 | args[1]; page_end = args[2] << 8 | args[3]; }
+	if(command == 0x36 && nargs == 1) madctl = args[0];
+	if(command == 0x33 && nargs == 6) { scroll_top = args[0] << 8 | args[1]; scroll_height = args[2] << 8 | args[3]; }
+	if(command == 0x37 && nargs == 2) scroll_start = args[0] << 8 | args[1];
+}
+
+void host_panel_select(int selected)
+{
+	if(cs_low != selected) host_stats.cs_toggles++;
+	cs_low = selected;
+}
+
+void host_panel_byte(int data, uint8_t b)
+{
+	dc_high = data;
+	wire_byte(b);
+}
+
+static void run_irqs(void);
+
+static void advance_time(uint64_t ns)
+{
+	time_ns += ns;
+	host_stats.time_ns += ns;
+	host_time_us = time_ns / 1000;
+	if(dma_done) run_irqs();
+}
+
+/* time the CPU spends on SPI5 instead of the program */
+static void block_cpu(uint64_t ns)
+{
+	host_stats.blocked_ns += ns;
+	advance_time(ns);
+}
+
+void host_reset_bytes(void)
+{
+	host_bytes_sent = 0;
+	host_frames_sent = 0;
+}
+
+void host_reset_stats(void)
+{
+	memset(&host_stats, 0, sizeof(host_stats));
+}
+
+void host_print_stats_header(void)
+{
+	printf("%-28s %8s %7s %6s %5s %5s %5s %6s %7s %9s\n", "call", "bytes", "frames", "trans", "dma", "cs", "cmds", "ramwr", "pixels", "wire us");
+}
+
+void host_print_stats(const char* name, const host_stats_t* stats)
+{
+	printf("%-28s %8u %7u %6u %5u %5u %5u %6u %7u %9.1f\n", name, (unsigned)stats->bytes, (unsigned)stats->frames,
+		   (unsigned)stats->transactions, (unsigned)stats->dma_transfers, (unsigned)stats->cs_toggles,
+		   (unsigned)stats->commands, (unsigned)stats->memory_writes, (unsigned)stats->pixels, stats->wire_ns / 1000.0);
+}
+
+/* panel line that the display shows on scan line y */
+static int scrolled_line(int y)
+{
+	if(y < scroll_top || y >= scroll_top + scroll_height || scroll_start < scroll_top || scroll_start >= scroll_top + scroll_height) return y;
+	return scroll_top + (y - scroll_top + scroll_start - scroll_top) % scroll_height;
+}
+
+/* the panel as RGB888, rows from the top of the screen */
+static void screen_rgb(uint8_t *rgb)
+{
+	for(int y = 0; y < HOST_PANEL_HEIGHT; y++)
+	{
+		for(int x = 0; x < HOST_PANEL_WIDTH; x++)
+		{
+			/* undo the mirroring so the picture reads like the screen */
+			int px = (madctl & 0x40) ? HOST_PANEL_WIDTH - 1 - x : x;
+			int py = scrolled_line((madctl & 0x80) ? HOST_PANEL_HEIGHT - 1 - y : y);
+			uint16_t c = panel[py][px];
+			*rgb++ = (c >> 11) << 3;
+			*rgb++ = ((c >> 5) & 63) << 2;
+			*rgb++ = (c & 31) << 3;
+		}
+	}
+}
+
+int host_write_ppm(const char* path)
+{
+	static uint8_t rgb[HOST_PANEL_HEIGHT][HOST_PANEL_WIDTH * 3];
+	FILE *f = fopen(path, "wb");
+	if(!f) return -1;
+
+	screen_rgb(&rgb[0][0]);
+	fprintf(f, "P6\n%d %d\n255\n", HOST_PANEL_WIDTH, HOST_PANEL_HEIGHT);
+	fwrite(rgb, 1, sizeof(rgb), f);
+	fclose(f);
+	return 0;
+}
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t size)
+{
+	static uint32_t table[256];
+
+	if(!table[1])
+	{
+		for(uint32_t n = 0; n < 256; n++)
+		{
+			uint32_t c = n;
+			for(int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320U ^ (c >> 1) : c >> 1;
+			table[n] = c;
+		}
+	}
+	crc = ~crc;
+	while(size--) crc = table[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+	return ~crc;
+}
+
+static void put_be32(uint8_t *p, uint32_t v)
+{
+	p[0] = v >> 24; p[1] = v >> 16; p[2] = v >> 8; p[3] = v;
+}
+
+static void png_chunk(FILE *f, const char *type, const uint8_t *data, uint32_t size)
+{
+	uint8_t word[4];
+
+	put_be32(word, size);
+	fwrite(word, 1, 4, f);
+	fwrite(type, 1, 4, f);
+	fwrite(data, 1, size, f);
+	put_be32(word, crc32_update(crc32_update(0, (const uint8_t*)type, 4), data, size));
+	fwrite(word, 1, 4, f);
+}
+
+/* PNG without compression: a zlib stream of stored deflate blocks, no zlib needed */
+int host_write_png(const char* path)
+{
+	enum { ROW = 1 + HOST_PANEL_WIDTH * 3, RAW = ROW * HOST_PANEL_HEIGHT, BLOCK = 65535 };
+	static uint8_t rgb[HOST_PANEL_HEIGHT][HOST_PANEL_WIDTH * 3];
+	static uint8_t raw[RAW];
+	static uint8_t zdata[2 + RAW + 5 * (RAW / BLOCK + 1) + 4];
+	FILE *f = fopen(path, "wb");
+	if(!f) return -1;
+
+	screen_rgb(&rgb[0][0]);
+	for(int y = 0; y < HOST_PANEL_HEIGHT; y++)
+	{
+		raw[y * ROW] = 0;	/* filter: none */
+		memcpy(&raw[y * ROW + 1], rgb[y], HOST_PANEL_WIDTH * 3);
+	}
+
+	uint32_t n = 0, a = 1, b = 0;
+	zdata[n++] = 0x78;
+	zdata[n++] = 0x01;
+	for(uint32_t i = 0; i < RAW; i += BLOCK)
+	{
+		uint32_t size = RAW - i < BLOCK ? RAW - i : BLOCK;
+		zdata[n++] = i + size == RAW;
+		zdata[n++] = size & 0xFF; zdata[n++] = size >> 8;
+		zdata[n++] = ~size & 0xFF; zdata[n++] = (~size >> 8) & 0xFF;
+		memcpy(&zdata[n], &raw[i], size);
+		n += size;
+	}
+	for(uint32_t i = 0; i < RAW; i++) { a = (a + raw[i]) % 65521; b = (b + a) % 65521; }
+	put_be32(&zdata[n], b << 16 | a);
+	n += 4;
+
+	uint8_t header[13];
+	put_be32(header, HOST_PANEL_WIDTH);
+	put_be32(header + 4, HOST_PANEL_HEIGHT);
+	header[8] = 8; header[9] = 2; header[10] = 0; header[11] = 0; header[12] = 0;	/* 8 bit RGB */
+
+	fwrite("\x89PNG\r\n\x1a\n", 1, 8, f);
+	png_chunk(f, "IHDR", header, sizeof(header));
+	png_chunk(f, "IDAT", zdata, n);
+	png_chunk(f, "IEND", NULL, 0);
+	fclose(f);
+	return 0;
+}
+
+static void run_irqs(void)
+{
+	if(in_irq || !irq_enabled || dma_hold) return;
+	in_irq = 1;
+	while(dma_done && (!dma_timed || time_ns >= dma_end_ns))
+	{
+		dma_done = 0;
+		HAL_SPI_TxCpltCallback(dma_spi);
+	}
+	in_irq = 0;
+}
+
+void host_hold_dma(int hold)
+{
+	dma_hold = hold;
+	run_irqs();
+}
+
+void host_dma_wire_time(int timed)
+{
+	dma_timed = timed;
+	run_irqs();
+}
+
+void host_wait(void)
+{
+	host_stats.waits++;
+
+	/* a wait loop can only end through the interrupt, so the clock runs to the end of the transfer */
+	if(dma_done && irq_enabled && !dma_hold && time_ns < dma_end_ns)
+	{
+		uint64_t ns = dma_end_ns - time_ns;
+		host_stats.wait_ns += ns;
+		block_cpu(ns);
+		return;
+	}
+	/* otherwise like a HAL_GetTick() poll */
+	host_stats.wait_ns += 1000;
+	block_cpu(1000);
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *port, GPIO_InitTypeDef *init) { (void)port; (void)init; }
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state)
+{
+	if(port == GPIOC && pin == GPIO_PIN_2)
+	{
+		if(cs_low != (state == GPIO_PIN_RESET)) host_stats.cs_toggles++;
+		cs_low = (state == GPIO_PIN_RESET);
+	}
+	if(port == GPIOD && pin == GPIO_PIN_13) dc_high = (state == GPIO_PIN_SET);
+}
+
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *h)
+{
+	h->Instance->CR1 = h->Init.DataSize | h->Init.BaudRatePrescaler;
+	return HAL_OK;
+}
+
+static int frame_16bit(SPI_HandleTypeDef *h)
+{
+	return (h->Instance->CR1 & SPI_CR1_DFF) != 0;
+}
+
+/* one write to the data register, f_SCK = PCLK2 / 2^(BR+1), returns its time on the wire */
+static uint64_t wire_frame(SPI_HandleTypeDef *h, uint16_t frame)
+{
+	uint32_t prescaler = 2U << ((h->Instance->CR1 & SPI_CR1_BR) >> 3);
+	uint32_t bits = frame_16bit(h) ? 16 : 8;
+	uint64_t ns = (uint64_t)bits * prescaler * 1000000000U / HOST_PCLK2_HZ;
+
+	host_frames_sent++;
+	host_stats.frames++;
+	host_stats.wire_ns += ns;
+	if(frame_16bit(h)) wire_byte(frame >> 8);
+	wire_byte(frame & 0xFF);
+	return ns;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *h, uint8_t *data, uint16_t size, uint32_t timeout)
+{
+	(void)timeout;
+	host_stats.transactions++;
+	for(uint16_t i = 0; i < size; i++) block_cpu(wire_frame(h, frame_16bit(h) ? ((uint16_t*)data)[i] : data[i]));
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *h, uint8_t *data, uint16_t size)
+{
+	uint32_t cr = h->hdmatx->Instance->CR;
+	int increment = (cr & DMA_SxCR_MINC) != 0;
+	int word = 1 << ((cr & DMA_SxCR_MSIZE) >> 13);
+	int item = 1 << ((cr & DMA_SxCR_PSIZE) >> 11);
+
+	if((item == 2) != frame_16bit(h))
+	{
+		fprintf(stderr, "DMA peripheral size %d does not match the SPI frame size\n", item);
+		return HAL_ERROR;
+	}
+
+	host_stats.transactions++;
+	host_stats.dma_transfers++;
+
+	/* without memory increment the stream reads the same memory word over and over */
+	uint64_t ns = 0;
+	for(uint16_t i = 0; i < size; i++)
+	{
+		if(item == 2) ns += wire_frame(h, ((uint16_t*)data)[increment ? i : 0]);
+		else ns += wire_frame(h, increment ? data[i] : data[i % word]);
+	}
+
+	/* the pixels reach the picture at once, only the interrupt waits for the wire time */
+	if(dma_timed) dma_end_ns = time_ns + ns;
+	else block_cpu(ns);
+
+	dma_spi = h;
+	dma_done = 1;
+	run_irqs();
+	return HAL_OK;
+}
+
+__weak void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *h) { (void)h; }
+__weak void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *h) { (void)h; }
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *h)
+{
+	h->Instance->CR = h->Init.MemInc | h->Init.PeriphDataAlignment | h->Init.MemDataAlignment | h->Init.Direction;
+	h->Instance->FCR = h->Init.FIFOMode;
+	return HAL_OK;
+}
+
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *h) { (void)h; }
+void HAL_NVIC_SetPriority(IRQn_Type irq, uint32_t pre, uint32_t sub) { (void)irq; (void)pre; (void)sub; }
+void HAL_NVIC_EnableIRQ(IRQn_Type irq) { if(irq == DMA2_Stream6_IRQn) { irq_enabled = 1; run_irqs(); } }
+void HAL_NVIC_DisableIRQ(IRQn_Type irq) { if(irq == DMA2_Stream6_IRQn) irq_enabled = 0; }
+void HAL_Delay(uint32_t ms) { advance_time((uint64_t)ms * 1000000); }
+uint32_t HAL_GetTick(void) { advance_time(1000); return (uint32_t)(host_time_us / 1000); }
@@ -0,0 +1,100 @@
+/**
+ * Host side of the LCD build: counts what the driver sends over SPI5 and
+ * keeps a picture of the panel built from the column/page/memory write commands.
+ */
+#ifndef HAL_MOCK_H
+#define HAL_MOCK_H
+
+#include <stdint.h>
+
+#define HOST_PANEL_WIDTH	240
+#define HOST_PANEL_HEIGHT	320
+
+/* SPI5 sits on APB2, 16 MHz HSI without APB prescaler like on the board */
+#ifndef HOST_PCLK2_HZ
+#define HOST_PCLK2_HZ		16000000U
+#endif
+
+/**
+ * What went over SPI5 since the last host_reset_stats().
+ */
+typedef struct
+{
+	uint32_t bytes;				/* bytes clocked out, with or without chip select */
+	uint32_t frames;			/* writes to the data register */
+	uint32_t transactions;		/* HAL_SPI_Transmit() and HAL_SPI_Transmit_DMA() calls */
+	uint32_t dma_transfers;		/* of which by DMA */
+	uint32_t cs_toggles;		/* edges of the chip select line */
+	uint32_t commands;			/* bytes sent with D/C low */
+	uint32_t memory_writes;		/* memory write commands (0x2C), one per address window drawn */
+	uint32_t pixels;			/* pixels written into the panel memory */
+	uint64_t wire_ns;			/* time of the frames on the wire at the prescaler in SPI5 CR1 */
+	uint64_t time_ns;			/* CPU clock: blocked time plus HAL_Delay() and HAL_GetTick() */
+	uint64_t blocked_ns;		/* CPU time lost to SPI5: polled frames, DMA frames without wire time, wait loops */
+	uint64_t wait_ns;			/* of which in the wait loops of the driver (ILI9341_WAIT_HOOK) */
+	uint32_t waits;				/* passes through those wait loops */
+} host_stats_t;
+
+extern host_stats_t host_stats;
+
+/**
+ * Bytes clocked out on SPI5 since the last host_reset_bytes().
+ */
+extern uint32_t host_bytes_sent;
+
+/**
+ * Writes to the SPI5 data register since the last host_reset_bytes(),
+ * one per byte in 8 bit frame mode and one per pixel in 16 bit frame mode.
+ */
+extern uint32_t host_frames_sent;
+
+/**
+ * Estimated time since start in microseconds: HAL_Delay() time plus the time
+ * the frames need on the wire at the SPI5 prescaler (8 MBit/s for prescaler 2
+ * from 16 MHz). Every HAL_GetTick() call counts as 1 us, so polling loops end.
+ */
+extern uint64_t host_time_us;
+
+/**
+ * While hold is set, a finished DMA transfer does not raise its interrupt, the
+ * way a slow SPI would keep it back: queued drawing commands pile up. Clearing
+ * it runs the held back interrupt. Anything that waits for the SPI meanwhile hangs.
+ */
+void host_hold_dma(int hold);
+
+/**
+ * While timed is set, a DMA transfer takes its wire time like on the board:
+ * the drawing call returns at once and the CPU clock only moves on with polled
+ * frames, HAL_Delay(), HAL_GetTick() and the wait loops of the driver. Those
+ * call host_wait() through ILI9341_WAIT_HOOK(), which moves the clock to the
+ * end of the running transfer and counts the time in wait_ns. Without it a
+ * DMA transfer blocks the CPU for its wire time and completes at once.
+ */
+void host_dma_wire_time(int timed);
+void host_wait(void);
+
+/**
+ * Direct line into the virtual panel for ILI9341_Transport_Host: chip select,
+ * and one byte with D/C high (data) or low (command). Counted in bytes,
+ * cs_toggles, commands, memory_writes and pixels, but not as SPI5 frames and
+ * without wire time.
+ */
+void host_panel_select(int selected);
+void host_panel_byte(int data, uint8_t b);
+
+void host_reset_bytes(void);
+void host_reset_stats(void);
+
+/**
+ * One line per measured call: a header, then host_print_stats() for each one.
+ */
+void host_print_stats_header(void);
+void host_print_stats(const char* name, const host_stats_t* stats);
+
+/**
+ * Snapshot of the screen as the viewer sees it (rotation and scrolling applied).
+ */
+int host_write_ppm(const char* path);
+int host_write_png(const char* path);
+
+#endif
@@ -0,0 +1,100 @@
+/**
+ * ILI9341_Transport_Host, see host_transport.h. Every call is done when it
+ * returns, like the polling transport, so the display list is worked off at once.
+ */
+#include <lcd/ILI9341_Queue.h>
+#include "host_transport.h"
+#include "hal_mock.h"
+
+static void host_init(void)
+{
+	host_panel_select(0);
+}
+
+static void host_command(uint8_t command, const uint8_t* parameters, uint16_t count)
+{
+	host_panel_select(1);
+	host_panel_byte(0, command);
+	for(uint16_t i = 0; i < count; i++) host_panel_byte(1, parameters[i]);
+}
+
+static void host_window(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+	const uint8_t column[4] = { x1 >> 8, x1, x2 >> 8, x2 };
+	const uint8_t page[4] = { y1 >> 8, y1, y2 >> 8, y2 };
+
+	host_panel_select(1);
+	host_panel_byte(0, 0x2A);
+	for(int i = 0; i < 4; i++) host_panel_byte(1, column[i]);
+	host_panel_byte(0, 0x2B);
+	for(int i = 0; i < 4; i++) host_panel_byte(1, page[i]);
+	host_panel_byte(0, 0x2C);
+}
+
+static void host_pixels(const uint16_t* colours, uint32_t size)
+{
+	if(size == 0) return;
+	host_panel_select(1);
+	for(uint32_t i = 0; i < size; i++)
+	{
+		host_panel_byte(1, colours[i] >> 8);
+		host_panel_byte(1, colours[i] & 0xFF);
+	}
+	host_panel_select(0);
+}
+
+static void host_bytes(const unsigned char* data, uint32_t size)
+{
+	if(size == 0) return;
+	host_panel_select(1);
+	for(uint32_t i = 0; i < size; i++) host_panel_byte(1, data[i]);
+	host_panel_select(0);
+}
+
+static void host_repeat(uint16_t colour, uint32_t size)
+{
+	if(size == 0) return;
+	host_panel_select(1);
+	for(uint32_t i = 0; i < size; i++)
+	{
+		host_panel_byte(1, colour >> 8);
+		host_panel_byte(1, colour & 0xFF);
+	}
+	host_panel_select(0);
+}
+
+static void host_end(void)
+{
+	host_panel_select(0);
+}
+
+static void host_run_queue(void)
+{
+	while(ILI9341_Queue_Next());
+	host_panel_select(0);
+}
+
+static uint8_t host_busy(void)
+{
+	return 0;
+}
+
+static uint8_t host_reading(const void* buffer)
+{
+	(void)buffer;
+	return 0;
+}
+
+const ILI9341_Transport ILI9341_Transport_Host =
+{
+	host_init,
+	host_command,
+	host_window,
+	host_pixels,
+	host_bytes,
+	host_repeat,
+	host_end,
+	host_run_queue,
+	host_busy,
+	host_reading,
+};
@@ -0,0 +1,14 @@
+/**
+ * Transport that writes straight into the virtual panel of hal_mock.c, with
+ * no SPI5, DMA or wire time in between. Drawing over it shows what the GFX
+ * code itself sends; the same calls over ILI9341_Transport_SPI_DMA and
+ * ILI9341_Transport_SPI_Polling add what the link costs.
+ */
+#ifndef HOST_TRANSPORT_H
+#define HOST_TRANSPORT_H
+
+#include <lcd/ILI9341_Transport.h>
+
+extern const ILI9341_Transport ILI9341_Transport_Host;
+
+#endif
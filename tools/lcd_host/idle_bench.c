@@ -0,0 +1,107 @@
+/**
+ * How long the CPU is held up by the panel while a frame goes out, over SPI5
+ * with DMA and polled.
+ *
+ * The DMA transfers take their wire time (host_dma_wire_time), so a drawing
+ * call returns as soon as its last transfer is started and the CPU clock only
+ * moves on where the CPU really waits: polled commands and address windows,
+ * and the wait loops of the driver for a transmit buffer or a free job slot.
+ * Every case is drawn, then lcd_wait_idle() is called:
+ *
+ *   call        time until the drawing call returned
+ *   blocked     of which the CPU spent on the SPI, polled or in a wait loop
+ *   wait_idle   time lcd_wait_idle() waited afterwards
+ *   free        share of the whole time the main loop could have used,
+ *               everything but the blocked time in the call
+ *
+ * The rendering itself costs no time here; on the board it runs while the
+ * previous transfer is on the wire.
+ */
+#include <stdio.h>
+#include <lcd/lcd.h>
+#include <lcd/ILI9341_Transport.h>
+#include "hal_mock.h"
+
+static lcd_text_field_t gesamt;
+static lcd_text_field_t runde_label;
+static lcd_text_field_t runde_zeit;
+static lcd_text_field_t mittel;
+
+/* what the stopwatch draws every 10 ms: the total time, mostly one digit */
+static void stopwatch_tick(void)
+{
+	lcd_text_field_draw(&gesamt, ": 01:23.46");
+}
+
+/* a lap press: total time, the new lap in the list and the mean lap time */
+static void stopwatch_lap(void)
+{
+	lcd_text_field_draw(&gesamt, ": 01:23.50");
+	lcd_text_field_draw(&runde_label, "Rd.4");
+	lcd_text_field_draw(&runde_zeit, ": 00:21.07");
+	lcd_text_field_draw(&mittel, ": 00:20.88");
+}
+
+/* the same through the display list, the interrupt opens the windows */
+static void stopwatch_lap_queued(void)
+{
+	lcd_queue_begin(ILI9341_QUEUE_BLOCK);
+	stopwatch_lap();
+}
+
+static void fill_screen(void)
+{
+	lcd_fill_screen(WHITE);
+}
+
+static void measure(const char* name, const char* transport, void (*draw)(void))
+{
+	host_reset_stats();
+	draw();
+	uint64_t call = host_stats.time_ns;
+	uint64_t blocked = host_stats.blocked_ns;
+	lcd_wait_idle();
+	uint64_t total = host_stats.time_ns;
+
+	printf("%-16s %-8s %8u %9.1f %9.1f %9.1f %9.1f %9.1f %5.1f %%\n", name, transport, (unsigned)host_stats.bytes,
+		   host_stats.wire_ns / 1000.0, call / 1000.0, blocked / 1000.0, (total - call) / 1000.0, total / 1000.0,
+		   total ? 100.0 * (total - blocked) / total : 100.0);
+}
+
+/* the stopwatch screen as it stands before the measured frame */
+static void stopwatch_screen(void)
+{
+	lcd_text_field_init(&gesamt, 90, 150, BLACK, 2, WHITE);
+	lcd_text_field_init(&runde_label, 10, 90, BLACK, 2, WHITE);
+	lcd_text_field_init(&runde_zeit, 95, 90, BLACK, 2, WHITE);
+	lcd_text_field_init(&mittel, 90, 190, BLACK, 2, WHITE);
+	lcd_text_field_draw(&gesamt, ": 01:23.45");
+	lcd_text_field_draw(&runde_label, "Rd.3");
+	lcd_text_field_draw(&runde_zeit, ": 00:20.96");
+	lcd_text_field_draw(&mittel, ": 00:20.81");
+	lcd_wait_idle();
+}
+
+static void run(const char* transport)
+{
+	measure("fill screen", transport, fill_screen);
+	stopwatch_screen();
+	measure("stopwatch tick", transport, stopwatch_tick);
+	stopwatch_screen();
+	measure("stopwatch lap", transport, stopwatch_lap);
+	stopwatch_screen();
+	measure("lap, queued", transport, stopwatch_lap_queued);
+	lcd_queue_end();
+}
+
+int main(void)
+{
+	lcd_init();
+	host_dma_wire_time(1);
+
+	printf("%-16s %-8s %8s %9s %9s %9s %9s %9s %7s\n", "case", "spi", "bytes", "wire us", "call us", "blocked", "wait_idle", "total us", "free");
+	run("dma");
+	ILI9341_Set_Transport(&ILI9341_Transport_SPI_Polling);
+	run("polling");
+	return 0;
+}
@@ -0,0 +1,122 @@
+/**
+ * Host replacement for the parts of the STM32F4 HAL that modules/lcd uses.
+ * Registers are plain structs, the functions are implemented in hal_mock.c.
+ */
+#ifndef HOST_STM32F4XX_HAL_H
+#define HOST_STM32F4XX_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define __IO volatile
+#define __weak __attribute__((weak))
+#define UNUSED(x) ((void)(x))
+#define __DMB() __sync_synchronize()
+
+typedef enum { HAL_OK = 0, HAL_ERROR, HAL_BUSY, HAL_TIMEOUT } HAL_StatusTypeDef;
+#define HAL_MAX_DELAY 0xFFFFFFFFU
+
+typedef struct { __IO uint32_t MODER, OTYPER, OSPEEDR, PUPDR, IDR, ODR, BSRR, LCKR, AFR[2]; } GPIO_TypeDef;
+typedef struct { __IO uint32_t CR1, CR2, SR, DR, CRCPR, RXCRCR, TXCRCR, I2SCFGR, I2SPR; } SPI_TypeDef;
+typedef struct { __IO uint32_t CR, NDTR, PAR, M0AR, M1AR, FCR; } DMA_Stream_TypeDef;
+
+extern GPIO_TypeDef host_gpioc, host_gpiod, host_gpiof;
+extern SPI_TypeDef host_spi5;
+extern DMA_Stream_TypeDef host_dma2_stream6;
+#define GPIOC (&host_gpioc)
+#define GPIOD (&host_gpiod)
+#define GPIOF (&host_gpiof)
+#define SPI5 (&host_spi5)
+#define DMA2_Stream6 (&host_dma2_stream6)
+
+typedef enum { DMA2_Stream6_IRQn = 69 } IRQn_Type;
+
+typedef enum { GPIO_PIN_RESET = 0, GPIO_PIN_SET } GPIO_PinState;
+#define GPIO_PIN_2 0x0004U
+#define GPIO_PIN_7 0x0080U
+#define GPIO_PIN_8 0x0100U
+#define GPIO_PIN_9 0x0200U
+#define GPIO_PIN_13 0x2000U
+#define GPIO_MODE_OUTPUT_PP 1U
+#define GPIO_MODE_AF_PP 2U
+#define GPIO_NOPULL 0U
+#define GPIO_SPEED_MEDIUM 1U
+#define GPIO_AF5_SPI5 5U
+typedef struct { uint32_t Pin, Mode, Pull, Speed, Alternate; } GPIO_InitTypeDef;
+
+#define SPI_MODE_MASTER 0x104U
+#define SPI_DIRECTION_2LINES 0U
+#define SPI_DATASIZE_8BIT 0U
+#define SPI_DATASIZE_16BIT 0x800U
+#define SPI_CR1_SPE (1U << 6)
+#define SPI_CR1_DFF (1U << 11)
+#define SPI_POLARITY_LOW 0U
+#define SPI_PHASE_1EDGE 0U
+#define SPI_NSS_SOFT 0x200U
+#define SPI_CR1_BR (7U << 3)
+#define SPI_BAUDRATEPRESCALER_2 0x00U
+#define SPI_BAUDRATEPRESCALER_4 0x08U
+#define SPI_BAUDRATEPRESCALER_8 0x10U
+#define SPI_BAUDRATEPRESCALER_16 0x18U
+#define SPI_BAUDRATEPRESCALER_32 0x20U
+#define SPI_BAUDRATEPRESCALER_64 0x28U
+#define SPI_BAUDRATEPRESCALER_128 0x30U
+#define SPI_BAUDRATEPRESCALER_256 0x38U
+#define SPI_FIRSTBIT_MSB 0U
+#define SPI_TIMODE_DISABLE 0U
+#define SPI_CRCCALCULATION_DISABLE 0U
+
+#define DMA_CHANNEL_7 0x0E000000U
+#define DMA_MEMORY_TO_PERIPH 0x40U
+#define DMA_PINC_DISABLE 0U
+#define DMA_MINC_ENABLE 0x400U
+#define DMA_PDATAALIGN_BYTE 0U
+#define DMA_MDATAALIGN_BYTE 0U
+#define DMA_NORMAL 0U
+#define DMA_PRIORITY_MEDIUM 0x10000U
+#define DMA_FIFOMODE_DISABLE 0U
+#define DMA_FIFO_THRESHOLD_FULL 3U
+#define DMA_SxCR_MINC (1U << 10)
+#define DMA_SxCR_PSIZE (3U << 11)
+#define DMA_SxCR_PSIZE_0 (1U << 11)
+#define DMA_SxCR_MSIZE (3U << 13)
+#define DMA_SxCR_MSIZE_0 (1U << 13)
+#define DMA_SxFCR_DMDIS (1U << 2)
+#define DMA_IT_FE 0x80U
+#define __HAL_DMA_DISABLE_IT(h, it) ((h)->Instance->FCR &= ~(it))
+
+typedef struct { uint32_t Channel, Direction, PeriphInc, MemInc, PeriphDataAlignment, MemDataAlignment, Mode, Priority, FIFOMode; } DMA_InitTypeDef;
+typedef struct { DMA_Stream_TypeDef *Instance; DMA_InitTypeDef Init; void *Parent; } DMA_HandleTypeDef;
+
+typedef struct { uint32_t Mode, Direction, DataSize, CLKPolarity, CLKPhase, NSS, BaudRatePrescaler, FirstBit, TIMode, CRCCalculation, CRCPolynomial; } SPI_InitTypeDef;
+typedef struct { SPI_TypeDef *Instance; SPI_InitTypeDef Init; DMA_HandleTypeDef *hdmatx; volatile uint32_t State; } SPI_HandleTypeDef;
+
+#define __HAL_SPI_ENABLE(h) ((h)->Instance->CR1 |= SPI_CR1_SPE)
+#define __HAL_SPI_DISABLE(h) ((h)->Instance->CR1 &= ~SPI_CR1_SPE)
+#define __HAL_LINKDMA(h, field, dma) do { (h)->field = &(dma); (dma).Parent = (h); } while(0)
+#define __GPIOC_CLK_ENABLE() do {} while(0)
+#define __GPIOD_CLK_ENABLE() do {} while(0)
+#define __GPIOF_CLK_ENABLE() do {} while(0)
+#define __SPI5_CLK_ENABLE() do {} while(0)
+#define __HAL_RCC_DMA2_CLK_ENABLE() do {} while(0)
+
+void HAL_GPIO_Init(GPIO_TypeDef *port, GPIO_InitTypeDef *init);
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state);
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *h);
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *h, uint8_t *data, uint16_t size, uint32_t timeout);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *h, uint8_t *data, uint16_t size);
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *h);
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *h);
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *h);
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *h);
+void HAL_NVIC_SetPriority(IRQn_Type irq, uint32_t pre, uint32_t sub);
+void HAL_NVIC_EnableIRQ(IRQn_Type irq);
+void HAL_NVIC_DisableIRQ(IRQn_Type irq);
+void HAL_Delay(uint32_t ms);
+uint32_t HAL_GetTick(void);
+
+/* the wait loops of modules/lcd let the DMA clock of hal_mock.c run, see host_dma_wire_time() */
+void host_wait(void);
+#define ILI9341_WAIT_HOOK() host_wait()
+
+#endif
@@ -0,0 +1,142 @@
+/**
+ * Runs one of each kind of drawing call against the virtual panel and prints
+ * what each call sent over SPI5: bytes, data register writes, HAL transfers,
+ * chip select edges, commands, address windows, pixels and the wire time at
+ * the configured prescaler. The screen is written to panel.png at the end.
+ *
+ *   panel_report [-s] [-t dma|polling|host]
+ *
+ * -s also writes a snapshot after every call, step_NN.png. Comparing the
+ * report and the pictures of two builds shows what a change to the drawing
+ * code costs or saves and whether the screen stayed the same.
+ * -t draws over another transport than the default SPI5 with DMA: polled
+ * SPI5, or straight into the panel without any link (host).
+ */
+#include <stdio.h>
+#include <string.h>
+#include <lcd/lcd.h>
+#include "my_lcd/my_lcd.h"
+#include "hal_mock.h"
+#include "host_transport.h"
+
+static int snapshots;
+static int step;
+static host_stats_t total;
+
+static void measured(const char* name)
+{
+	lcd_wait_idle();
+	host_print_stats(name, &host_stats);
+
+	total.bytes += host_stats.bytes;
+	total.frames += host_stats.frames;
+	total.transactions += host_stats.transactions;
+	total.dma_transfers += host_stats.dma_transfers;
+	total.cs_toggles += host_stats.cs_toggles;
+	total.commands += host_stats.commands;
+	total.memory_writes += host_stats.memory_writes;
+	total.pixels += host_stats.pixels;
+	total.wire_ns += host_stats.wire_ns;
+
+	if(snapshots)
+	{
+		char path[32];
+		snprintf(path, sizeof(path), "step_%02d.png", step);
+		host_write_png(path);
+	}
+	step++;
+	host_reset_stats();
+}
+
+/* every call is drawn, waited for and reported on its own */
+#define MEASURE(name, call)	do { call; measured(name); } while(0)
+
+static uint16_t gradient_pixels[32 * 32];
+static const ILI9341_Image gradient = { 32, 32, ILI9341_IMAGE_RAW, 0, 0, (const uint8_t*)gradient_pixels, sizeof(gradient_pixels) };
+
+/* a run of 24 red pixels, a literal of 4 and a run of 36 white pixels, filling 4 rows of 16 */
+static const uint8_t stripes_data[] = { 0x97, 0xF8, 0x00, 0x03, 0x00, 0x1F, 0x07, 0xE0, 0x00, 0x1F, 0x07, 0xE0, 0xA3, 0xFF, 0xFF };
+static const ILI9341_Image stripes = { 16, 4, ILI9341_IMAGE_RLE, 0, 0, stripes_data, sizeof(stripes_data) };
+
+static uint16_t button_pixels[64 * 24];
+
+/* a button and its label drawn in RAM and sent as one window */
+static void draw_button(void)
+{
+	ILI9341_Region region;
+
+	ILI9341_Region_Init(&region, button_pixels, 165, 292, 64, 24);
+	lcd_region_begin(&region);
+	lcd_draw_rect(165, 292, 229, 316, WHITE, 1);
+	lcd_draw_round_rect(165, 292, 64, 24, 6, GREEN, 1);
+	lcd_draw_text_at_coord("Start", 167, 296, WHITE, 2, GREEN);
+	lcd_region_end();
+}
+
+static const ILI9341_Point zigzag[] = { { 10, 310 }, { 60, 295 }, { 110, 310 }, { 160, 295 } };
+
+int main(int argc, char** argv)
+{
+	lcd_text_field_t field;
+	uint16_t block[16 * 16];
+
+	for(int i = 1; i < argc; i++)
+	{
+		if(strcmp(argv[i], "-s") == 0) snapshots = 1;
+		if(strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+		{
+			const char* name = argv[++i];
+			if(strcmp(name, "polling") == 0) ILI9341_Set_Transport(&ILI9341_Transport_SPI_Polling);
+			else if(strcmp(name, "host") == 0) ILI9341_Set_Transport(&ILI9341_Transport_Host);
+			else if(strcmp(name, "dma") != 0)
+			{
+				fprintf(stderr, "unknown transport %s\n", name);
+				return 1;
+			}
+		}
+	}
+	for(int i = 0; i < 32 * 32; i++) gradient_pixels[i] = (uint16_t)(((i % 32) << 11) | ((i / 32) << 6) | 0x1F);
+	for(int i = 0; i < 16 * 16; i++) block[i] = (i & 1) ? RED : YELLOW;
+
+	host_print_stats_header();
+	host_reset_stats();
+	MEASURE("lcd_init", lcd_init());
+	MEASURE("lcd_fill_screen", lcd_fill_screen(WHITE));
+	MEASURE("lcd_draw_rect filled", lcd_draw_rect(10, 10, 110, 60, RED, 1));
+	MEASURE("lcd_draw_rect hollow", lcd_draw_rect(20, 70, 200, 120, BLUE, 0));
+	MEASURE("lcd_draw_circle filled", lcd_draw_circle(60, 170, 40, GREEN, 1));
+	MEASURE("lcd_draw_circle hollow", lcd_draw_circle(60, 170, 50, BLACK, 0));
+	MEASURE("lcd_draw_horizontal_line", lcd_draw_horizontal_line(0, 230, 240, MAGENTA));
+	MEASURE("lcd_draw_vertical_line", lcd_draw_vertical_line(230, 0, 320, CYAN));
+	MEASURE("lcd_draw_pixel", lcd_draw_pixel(120, 160, BLACK));
+	MEASURE("lcd_draw_line flat", lcd_draw_line(10, 300, 220, 285, BLACK));
+	MEASURE("lcd_draw_line steep", lcd_draw_line(200, 140, 215, 220, BLACK));
+	MEASURE("lcd_draw_polyline 4 points", lcd_draw_polyline(zigzag, 4, BLUE));
+	MEASURE("lcd_draw_triangle filled", lcd_draw_triangle(150, 150, 190, 130, 170, 200, MAGENTA, 1));
+	MEASURE("lcd_draw_round_rect filled", lcd_draw_round_rect(120, 205, 75, 20, 8, YELLOW, 1));
+	MEASURE("lcd_draw_round_rect hollow", lcd_draw_round_rect(118, 203, 79, 24, 10, BLACK, 0));
+	lcd_set_clip(0, 0, 239, 60);
+	MEASURE("lcd_draw_circle clipped", lcd_draw_circle(200, 70, 30, BLUE, 1));
+	lcd_clip_off();
+	MEASURE("lcd_draw_pixels 16x16", lcd_draw_pixels(210, 45, 16, 16, block));
+	MEASURE("lcd_draw_image raw 32x32", lcd_draw_image(&gradient, 150, 20));
+	MEASURE("lcd_draw_image rle 16x4", lcd_draw_image(&stripes, 190, 20));
+	MEASURE("text size 1, 12 chars", lcd_draw_text_at_coord("Hello panel!", 120, 70, BLACK, 1, WHITE));
+	MEASURE("text size 2, 7 chars", lcd_draw_text_at_coord("21.35 C", 120, 90, RED, 2, WHITE));
+	MEASURE("text size 3, 5 chars", lcd_draw_text_at_coord("12:34", 120, 240, BLUE, 3, WHITE));
+	MEASURE("text Prop_2, 9 chars", lcd_draw_text_font("Luftdruck", 120, 110, &ILI9341_Font_Prop_2, BLACK, WHITE));
+	lcd_text_field_init(&field, 10, 270, BLACK, 2, WHITE);
+	MEASURE("text field, first draw", lcd_text_field_draw(&field, "00:12.3"));
+	MEASURE("text field, one digit", lcd_text_field_draw(&field, "00:12.4"));
+	MEASURE("text field, two digits", lcd_text_field_draw(&field, "00:21.4"));
+	MEASURE("button in a region", draw_button());
+	MEASURE("my_lcd_draw_baargraph", my_lcd_draw_baargraph(120, 160, 100, 20, 400, GREEN, YELLOW));
+	MEASURE("lcd_set_scroll_area", lcd_set_scroll_area(40, 200));
+	MEASURE("lcd_scroll", lcd_scroll(10));
+	MEASURE("lcd_scroll_off", lcd_scroll_off());
+
+	printf("\n");
+	host_print_stats("total", &total);
+	host_write_png("panel.png");
+	return 0;
+}
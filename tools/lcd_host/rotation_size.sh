@@ -0,0 +1,50 @@
+#!/bin/sh
+# Instructions of the drawing functions with the orientation fixed at build
+# time (the default) and with ILI9341_ROTATION_RUNTIME=1.
+#   ./rotation_size.sh
+# The code is compiled for the host with -Os, so the counts are x86-64 ones,
+# not Cortex-M4 ones; the difference between the two columns is what matters.
+set -e
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+MODULES="$HERE/../../modules"
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+# instructions of one function in an object file
+count()
+{
+	objdump -d --no-show-raw-insn "$1" | awk -v f="<$2>:" '
+		$2 == f { on = 1; next }
+		on && /^$/ { exit }
+		on && /:\t/ { n++ }
+		END { print n + 0 }'
+}
+
+FILES="ILI9341_STM32_Driver ILI9341_SPI ILI9341_SPI_DMA ILI9341_GFX ILI9341_Font ILI9341_Image ILI9341_Queue ILI9341_Shapes ILI9341_Shadow"
+
+for mode in fixed runtime; do
+	DEFINE=""
+	[ $mode = runtime ] && DEFINE="-DILI9341_ROTATION_RUNTIME=1"
+	mkdir "$TMP/$mode"
+	for f in $FILES; do
+		gcc -std=gnu11 -Os -c $DEFINE -DILI9341_SHADOW_ENABLE=1 \
+			-I"$HERE/include" -I"$HERE" -I"$MODULES" \
+			-o "$TMP/$mode/$f.o" "$MODULES/lcd/$f.c"
+	done
+done
+
+# every function whose code depends on the orientation, then the sum over all of them
+printf "%-32s %7s %9s %7s\n" function fixed runtime saved
+total_fixed=0
+total_runtime=0
+for f in $FILES; do
+	for fn in $(nm --defined-only "$TMP/fixed/$f.o" | awk '$2 ~ /^[Tt]$/ { print $3 }'); do
+		fixed=$(count "$TMP/fixed/$f.o" $fn)
+		runtime=$(count "$TMP/runtime/$f.o" $fn)
+		total_fixed=$((total_fixed + fixed))
+		total_runtime=$((total_runtime + runtime))
+		[ "$fixed" -ne "$runtime" ] && printf "%-32s %7d %9d %7d\n" $fn $fixed $runtime $((runtime - fixed))
+	done
+done
+printf "%-32s %7d %9d %7d\n" "all functions" $total_fixed $total_runtime $((total_runtime - total_fixed))
@@ -0,0 +1,118 @@
+/**
+ * Checks the lap store of modules/runden against a brute force computation:
+ * 1000 random laps are added, and after every lap the count, best and worst
+ * lap, sum, mean, delta and standard deviation are compared with the values
+ * computed over all laps so far. At the end every lap is read back; the ones
+ * in the RAM ring or the backup SRAM log must match, the others must be
+ * reported as gone. Stops with the first difference and exits with 1.
+ *
+ * The backup SRAM is a plain array here. The standard deviation may differ
+ * by less than 1 ms, the deviations are summed in ms.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+
+static uint8_t bkpsram[4096] __attribute__((aligned(8)));
+#define BKPSRAM_BASE						((uintptr_t)bkpsram)
+#define __HAL_RCC_PWR_CLK_ENABLE()			do {} while(0)
+#define HAL_PWR_EnableBkUpAccess()			do {} while(0)
+#define __HAL_RCC_BKPSRAM_CLK_ENABLE()		do {} while(0)
+#include "runden/runden.c"
+
+#define LAPS	1000
+
+static uint64_t laps[LAPS];
+
+/* mostly laps of 20 s give or take 3 s, now and then one of several minutes */
+static uint64_t random_lap(void)
+{
+	if(rand() % 50 == 0) return 60000000ULL + (uint64_t)rand() % 600000000ULL;
+	return 17000000ULL + (uint64_t)rand() % 6000000ULL;
+}
+
+static int compare(const char* what, int lap, uint64_t got, uint64_t expected)
+{
+	if(got == expected) return 1;
+	printf("lap %d: %s is %llu, expected %llu\n", lap, what, (unsigned long long)got, (unsigned long long)expected);
+	return 0;
+}
+
+/* everything runden_statistik() and the functions on it report after n laps */
+static int check_statistics(int n)
+{
+	const runden_statistik_t* statistik = runden_statistik();
+	uint64_t best = laps[0], worst = laps[0], sum = 0;
+	uint32_t best_number = 0, worst_number = 0;
+	double mean, squares = 0;
+
+	for(int i = 0; i < n; i++)
+	{
+		if(laps[i] < best) { best = laps[i]; best_number = i; }
+		if(laps[i] > worst) { worst = laps[i]; worst_number = i; }
+		sum += laps[i];
+	}
+	mean = (double)sum / n;
+	for(int i = 0; i < n; i++) squares += ((double)laps[i] - mean) * ((double)laps[i] - mean);
+	double deviation = (n > 1) ? sqrt(squares / (n - 1)) : 0;
+
+	int ok = compare("count", n, runden_anzahl(), n)
+		&& compare("best", n, statistik->beste_us, best)
+		&& compare("best number", n, statistik->beste_nummer, best_number)
+		&& compare("worst", n, statistik->schlechteste_us, worst)
+		&& compare("worst number", n, statistik->schlechteste_nummer, worst_number)
+		&& compare("sum", n, statistik->summe_us, sum)
+		&& compare("mean", n, runden_mittel_us(), sum / n)
+		&& compare("delta", n, (uint64_t)statistik->delta_us, (n > 1) ? laps[n - 1] - laps[n - 2] : 0);
+	if(!ok) return 0;
+
+	double error = fabs((double)runden_standardabweichung_us() - deviation);
+	if(error >= 1000)
+	{
+		printf("lap %d: standard deviation is %llu us, expected %.0f us\n", n, (unsigned long long)runden_standardabweichung_us(), deviation);
+		return 0;
+	}
+	return 1;
+}
+
+int main(void)
+{
+	int stored = 0;
+
+	srand(1);
+	runden_init();
+
+	for(int n = 1; n <= LAPS; n++)
+	{
+		laps[n - 1] = random_lap();
+		runden_hinzufuegen(laps[n - 1]);
+		if(!check_statistics(n)) return 1;
+	}
+
+	for(int i = 0; i < LAPS; i++)
+	{
+		runde_t runde;
+		int expected = (LAPS - i <= RUNDEN_RAM_ANZAHL) || (i < RUNDEN_LOG_ANZAHL);
+
+		if(runden_holen(i, &runde) != expected)
+		{
+			printf("lap %d: %s\n", i, expected ? "missing" : "should be gone");
+			return 1;
+		}
+		if(!expected) continue;
+		if(!compare("number", i, runde.nummer, i) || !compare("time", i, runde.zeit_us, laps[i])
+		   || !compare("delta", i, (uint64_t)runde.delta_us, i ? laps[i] - laps[i - 1] : 0)) return 1;
+		stored++;
+	}
+
+	double sum = 0, squares = 0;
+	for(int i = 0; i < LAPS; i++) sum += laps[i];
+	for(int i = 0; i < LAPS; i++) squares += (laps[i] - sum / LAPS) * (laps[i] - sum / LAPS);
+	double error = fabs((double)runden_standardabweichung_us() - sqrt(squares / (LAPS - 1)));
+
+	printf("%d laps: statistics right after every lap, %d laps read back (ring %d, log %d), "
+		   "standard deviation %llu us, off by %.0f us\n", LAPS, stored, RUNDEN_RAM_ANZAHL, (int)RUNDEN_LOG_ANZAHL,
+		   (unsigned long long)runden_standardabweichung_us(), error);
+	return 0;
+}
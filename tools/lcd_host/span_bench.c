@@ -0,0 +1,111 @@
+/**
+ * SPI bytes, chip select edges and address windows of the primitives that
+ * used to set one pixel at a time, drawn with their span code and, as the
+ * reference, with one address window per pixel of the same shape.
+ *
+ * The shape is first drawn into a region to find its pixels; the reference
+ * then sends every pixel that is not the white background with
+ * lcd_draw_pixel(). Both go onto the same white box, and the program checks
+ * that both leave the same picture.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <lcd/lcd.h>
+#include "my_lcd/my_lcd.h"
+#include "hal_mock.h"
+
+#define BOX			120
+#define UNDRAWN		0x0821
+
+static uint16_t shape[BOX * BOX];
+static uint8_t picture[2][HOST_PANEL_WIDTH * HOST_PANEL_HEIGHT * 3 + 64];
+
+static void filled_circle(void) { lcd_draw_circle(60, 60, 40, GREEN, 1); }
+static void hollow_circle(void) { lcd_draw_circle(60, 60, 50, BLACK, 0); }
+static void text_size_1(void) { lcd_draw_text_at_coord("Hello panel!", 5, 5, BLACK, 1, WHITE); }
+static void diag_cross(void) { draw_diag_cross(10, 10, RED); }
+
+/* the screen as a PPM image in memory */
+static size_t snapshot(uint8_t* buffer)
+{
+	FILE* f;
+	size_t size;
+
+	host_write_ppm("span_bench.ppm");
+	f = fopen("span_bench.ppm", "rb");
+	if(!f) return 0;
+	size = fread(buffer, 1, sizeof(picture[0]), f);
+	fclose(f);
+	remove("span_bench.ppm");
+	return size;
+}
+
+static void clear_box(void)
+{
+	lcd_draw_rect(0, 0, BOX, BOX, WHITE, 1);
+	lcd_wait_idle();
+}
+
+/* one address window per pixel of the shape, like the primitives before the span API */
+static void per_pixel(void)
+{
+	for(int y = 0; y < BOX; y++)
+	{
+		for(int x = 0; x < BOX; x++)
+		{
+			uint16_t colour = shape[y * BOX + x];
+			if(colour != UNDRAWN && colour != WHITE) lcd_draw_pixel(x, y, colour);
+		}
+	}
+}
+
+static host_stats_t measure(void (*draw)(void))
+{
+	host_stats_t stats;
+
+	clear_box();
+	host_reset_stats();
+	draw();
+	lcd_wait_idle();
+	stats = host_stats;
+	return stats;
+}
+
+static int bench(const char* name, void (*draw)(void))
+{
+	ILI9341_Region region;
+	host_stats_t spans, pixels;
+	size_t size;
+
+	spans = measure(draw);
+	size = snapshot(picture[0]);
+
+	for(int i = 0; i < BOX * BOX; i++) shape[i] = UNDRAWN;
+	ILI9341_Region_Init(&region, shape, 0, 0, BOX, BOX);
+	lcd_region_begin(&region);
+	draw();
+	lcd_region_end();
+
+	pixels = measure(per_pixel);
+	int same = snapshot(picture[1]) == size && memcmp(picture[0], picture[1], size) == 0;
+
+	printf("%-18s %8u %8u %6u %6u %6u %6u %7.1fx   %s\n", name, (unsigned)spans.bytes, (unsigned)pixels.bytes,
+		   (unsigned)spans.cs_toggles, (unsigned)pixels.cs_toggles, (unsigned)spans.memory_writes,
+		   (unsigned)pixels.memory_writes, (double)pixels.bytes / spans.bytes, same ? "same" : "DIFFERENT");
+	return same;
+}
+
+int main(void)
+{
+	int same = 1;
+
+	lcd_init();
+	lcd_fill_screen(WHITE);
+
+	printf("%-18s %8s %8s %6s %6s %6s %6s %8s\n", "primitive", "bytes", "per pix", "cs", "per pix", "ramwr", "per pix", "saved");
+	same &= bench("filled circle r40", filled_circle);
+	same &= bench("hollow circle r50", hollow_circle);
+	same &= bench("text size 1", text_size_1);
+	same &= bench("draw_diag_cross", diag_cross);
+	return same ? 0 : 1;
+}
@@ -0,0 +1,243 @@
+/**
+ * Converts a binary PPM (P6) picture into a C file with one ILI9341_Image
+ * (see modules/lcd/ILI9341_Image.h).
+ *
+ *   lcd_image [-f raw|rle|palette] input.ppm name > name.c
+ *
+ * Without -f the smallest format is used. The palette format is only possible
+ * for pictures with up to 256 colours after the reduction to RGB565.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define FORMAT_RAW		0
+#define FORMAT_RLE		1
+#define FORMAT_PALETTE	2
+
+static const char* format_names[] = { "ILI9341_IMAGE_RAW", "ILI9341_IMAGE_RLE", "ILI9341_IMAGE_RLE_PALETTE" };
+
+/* run length from which a run packet is written instead of extending a literal */
+#define MIN_RUN		3
+#define MAX_COUNT	0xFFFF
+
+typedef struct
+{
+	uint8_t *data;
+	size_t size, capacity;
+} buffer_t;
+
+static void put(buffer_t *b, uint8_t byte)
+{
+	if(b->size == b->capacity)
+	{
+		b->capacity = b->capacity ? b->capacity * 2 : 4096;
+		b->data = realloc(b->data, b->capacity);
+		if(!b->data) { perror("realloc"); exit(1); }
+	}
+	b->data[b->size++] = byte;
+}
+
+static void put_value(buffer_t *b, uint16_t value, int bytes)
+{
+	if(bytes == 2) put(b, value >> 8);
+	put(b, value & 0xFF);
+}
+
+static void put_control(buffer_t *b, int run, uint32_t count)
+{
+	uint8_t flag = run ? 0x80 : 0;
+
+	if(count <= 127)
+	{
+		put(b, flag | (count - 1));
+	}
+	else
+	{
+		put(b, flag | 0x7F);
+		put(b, count >> 8);
+		put(b, count & 0xFF);
+	}
+}
+
+/* packs the values (RGB565 colours or palette indices) into run and literal packets */
+static void encode(buffer_t *out, const uint16_t *values, uint32_t n, int bytes)
+{
+	uint32_t i = 0;
+
+	while(i < n)
+	{
+		uint32_t run = 1;
+		while(i + run < n && run < MAX_COUNT && values[i + run] == values[i]) run++;
+
+		if(run >= MIN_RUN)
+		{
+			put_control(out, 1, run);
+			put_value(out, values[i], bytes);
+			i += run;
+			continue;
+		}
+
+		/* literal up to the next run worth its own packet */
+		uint32_t start = i;
+		while(i < n && i - start < MAX_COUNT)
+		{
+			run = 1;
+			while(i + run < n && run < MIN_RUN && values[i + run] == values[i]) run++;
+			if(run >= MIN_RUN) break;
+			i++;
+		}
+		put_control(out, 0, i - start);
+		for(uint32_t k = start; k < i; k++) put_value(out, values[k], bytes);
+	}
+}
+
+static int read_token(FILE *f, unsigned *value)
+{
+	int c;
+
+	/* whitespace and comments between the header fields */
+	while((c = fgetc(f)) != EOF)
+	{
+		if(c == '#') { while((c = fgetc(f)) != EOF && c != '\n'); continue; }
+		if(c != ' ' && c != '\t' && c != '\r' && c != '\n') break;
+	}
+	if(c == EOF) return -1;
+	ungetc(c, f);
+	return fscanf(f, "%u", value) == 1 ? 0 : -1;
+}
+
+static uint16_t *read_ppm(const char *path, unsigned *width, unsigned *height)
+{
+	FILE *f = fopen(path, "rb");
+	unsigned maxval;
+
+	if(!f) { perror(path); return NULL; }
+	if(fgetc(f) != 'P' || fgetc(f) != '6' || read_token(f, width) || read_token(f, height) ||
+	   read_token(f, &maxval) || maxval == 0 || maxval > 255 || *width == 0 || *height == 0 ||
+	   *width > 0xFFFF || *height > 0xFFFF)
+	{
+		fprintf(stderr, "%s: not a binary 8 bit PPM (P6)\n", path);
+		fclose(f);
+		return NULL;
+	}
+	fgetc(f);
+
+	uint32_t n = *width * *height;
+	uint16_t *pixels = malloc(n * sizeof(uint16_t));
+	for(uint32_t i = 0; i < n; i++)
+	{
+		int r = fgetc(f), g = fgetc(f), b = fgetc(f);
+		if(b == EOF) { fprintf(stderr, "%s: file too short\n", path); fclose(f); free(pixels); return NULL; }
+		r = r * 255 / maxval; g = g * 255 / maxval; b = b * 255 / maxval;
+		pixels[i] = (uint16_t)((r >> 3) << 11 | (g >> 2) << 5 | (b >> 3));
+	}
+	fclose(f);
+	return pixels;
+}
+
+/* returns the number of colours or 0 if there are more than 256 */
+static unsigned make_palette(const uint16_t *pixels, uint32_t n, uint16_t *palette, uint16_t *indices)
+{
+	unsigned colours = 0;
+
+	for(uint32_t i = 0; i < n; i++)
+	{
+		unsigned k;
+		for(k = 0; k < colours && palette[k] != pixels[i]; k++);
+		if(k == colours)
+		{
+			if(colours == 256) return 0;
+			palette[colours++] = pixels[i];
+		}
+		indices[i] = k;
+	}
+	return colours;
+}
+
+static void write_array(const char *type, const char *name, const char *suffix, const uint8_t *data, size_t size)
+{
+	printf("static const %s %s_%s[] =\n{", type, name, suffix);
+	for(size_t i = 0; i < size; i++) printf("%s0x%02X,", i % 16 ? " " : "\n\t", data[i]);
+	printf("\n};\n\n");
+}
+
+int main(int argc, char **argv)
+{
+	int format = -1;
+	int arg = 1;
+
+	if(argc >= 3 && strcmp(argv[1], "-f") == 0)
+	{
+		if(strcmp(argv[2], "raw") == 0) format = FORMAT_RAW;
+		else if(strcmp(argv[2], "rle") == 0) format = FORMAT_RLE;
+		else if(strcmp(argv[2], "palette") == 0) format = FORMAT_PALETTE;
+		else { fprintf(stderr, "unknown format %s\n", argv[2]); return 1; }
+		arg = 3;
+	}
+	if(argc - arg != 2)
+	{
+		fprintf(stderr, "usage: %s [-f raw|rle|palette] input.ppm name > name.c\n", argv[0]);
+		return 1;
+	}
+	const char *path = argv[arg], *name = argv[arg + 1];
+
+	unsigned width, height;
+	uint16_t *pixels = read_ppm(path, &width, &height);
+	if(!pixels) return 1;
+	uint32_t n = width * height;
+
+	buffer_t encoded[3] = { { 0 } };
+	uint16_t palette[256];
+	uint16_t *indices = malloc(n * sizeof(uint16_t));
+	unsigned colours = make_palette(pixels, n, palette, indices);
+
+	for(uint32_t i = 0; i < n; i++) put_value(&encoded[FORMAT_RAW], pixels[i], 2);	/* only counted, written as uint16_t */
+	encode(&encoded[FORMAT_RLE], pixels, n, 2);
+	if(colours) encode(&encoded[FORMAT_PALETTE], indices, n, 1);
+
+	size_t sizes[3];
+	for(int f = 0; f < 3; f++) sizes[f] = encoded[f].size + (f == FORMAT_PALETTE ? colours * 2 : 0);
+	fprintf(stderr, "%s: %ux%u, raw %zu bytes, rle %zu bytes", path, width, height, sizes[FORMAT_RAW], sizes[FORMAT_RLE]);
+	if(colours) fprintf(stderr, ", palette (%u colours) %zu bytes\n", colours, sizes[FORMAT_PALETTE]);
+	else fprintf(stderr, ", more than 256 colours, no palette\n");
+
+	if(format == FORMAT_PALETTE && !colours)
+	{
+		fprintf(stderr, "%s has more than 256 colours\n", path);
+		return 1;
+	}
+	if(format < 0)
+	{
+		format = FORMAT_RAW;
+		if(sizes[FORMAT_RLE] < sizes[format]) format = FORMAT_RLE;
+		if(colours && sizes[FORMAT_PALETTE] < sizes[format]) format = FORMAT_PALETTE;
+	}
+
+	printf("/* Generated by tools/lcd_image from %s: %ux%u, %s, %zu bytes */\n", path, width, height, format_names[format], sizes[format]);
+	printf("#include <lcd/ILI9341_Image.h>\n\n");
+	if(format == FORMAT_PALETTE)
+	{
+		printf("static const uint16_t %s_palette[] =\n{", name);
+		for(unsigned i = 0; i < colours; i++) printf("%s0x%04X,", i % 8 ? " " : "\n\t", palette[i]);
+		printf("\n};\n\n");
+	}
+	if(format == FORMAT_RAW)
+	{
+		/* native half-words, the driver sends them in 16 bit SPI frames */
+		printf("static const uint16_t %s_data[] =\n{", name);
+		for(uint32_t i = 0; i < n; i++) printf("%s0x%04X,", i % 8 ? " " : "\n\t", pixels[i]);
+		printf("\n};\n\n");
+	}
+	else
+	{
+		write_array("uint8_t", name, "data", encoded[format].data, encoded[format].size);
+	}
+	printf("const ILI9341_Image %s =\n{\n", name);
+	printf("\t%u, %u, %s,\n", width, height, format_names[format]);
+	if(format == FORMAT_PALETTE) printf("\t%u, %s_palette,\n", colours, name);
+	else printf("\t0, 0,\n");
+	printf("\t(const uint8_t*)%s_data, sizeof(%s_data)\n};\n", name, name);
+	return 0;
+}